@@ -0,0 +1,70 @@
+#include "Benchmarks.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+
+/**
+ * Benchmarks reproduces the measurements quoted for PaceMaker's performance changes. Build it in Release:
+ *
+ *   Benchmarks [name ...]
+ *
+ * Without names every benchmark runs. Numbers are the fastest of several repetitions; compare them on one machine.
+ */
+
+namespace
+{
+  struct Benchmark
+  {
+    const char* name;
+    const char* description;
+    int (*run)();
+  };
+
+  constexpr Benchmark BENCHMARKS[] = {
+    { "broker", "DataBroker publish cost, 1 to 64 subscribers", pacemaker::benchmarks::RunBrokerBenchmark },
+    { "fieldtable", "FieldTable sort and scan, 20 to 200 cars", pacemaker::benchmarks::RunFieldTableBenchmark },
+    { "udp", "UDP receive cost, recvmmsg() against io_uring at 1 and 10 kHz", pacemaker::benchmarks::RunUdpReceiveBenchmark },
+    { "relative", "RelativeTimingEngine, 200 cars at 100 Hz", pacemaker::benchmarks::RunRelativeTimingBenchmark },
+    { "inputgraph", "Input graph frame CPU, 200 to 20,000 samples; opens a hidden window", pacemaker::benchmarks::RunInputGraphBenchmark },
+  };
+} // namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    const bool isKnown = std::any_of(std::begin(BENCHMARKS), std::end(BENCHMARKS),
+      [name = argv[i]](const Benchmark& benchmark) { return std::strcmp(benchmark.name, name) == 0; });
+    if (!isKnown)
+    {
+      std::fprintf(stderr, "Unknown benchmark %s, available:\n", argv[i]);
+      for (const Benchmark& benchmark : BENCHMARKS)
+      {
+        std::fprintf(stderr, "  %-12s %s\n", benchmark.name, benchmark.description);
+      }
+      return EXIT_FAILURE;
+    }
+  }
+
+  int result = EXIT_SUCCESS;
+  for (const Benchmark& benchmark : BENCHMARKS)
+  {
+    const bool isSelected = argc < 2 || std::any_of(argv + 1, argv + argc,
+      [&benchmark](const char* name) { return std::strcmp(benchmark.name, name) == 0; });
+    if (!isSelected)
+    {
+      continue;
+    }
+
+    std::printf("== %s: %s\n", benchmark.name, benchmark.description);
+    if (benchmark.run() != EXIT_SUCCESS)
+    {
+      result = EXIT_FAILURE;
+    }
+    std::printf("\n");
+  }
+  return result;
+}
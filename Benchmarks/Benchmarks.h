@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker::benchmarks
+{
+  using Clock = std::chrono::steady_clock;
+
+  /** @brief Keeps a value alive so the compiler cannot drop the work that produced it. */
+  template<typename T>
+  void KeepAlive(const T& value)
+  {
+    static std::atomic<uint64_t> sink{ 0 };
+    sink.fetch_add(static_cast<uint64_t>(value), std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Times a piece of work: runs it iterations times per repetition and keeps the fastest repetition, which is
+   *        the one least disturbed by the rest of the system.
+   * @return Nanoseconds per iteration.
+   */
+  template<typename Body>
+  double MeasureNs(size_t iterations, Body&& body, int repetitions = 5)
+  {
+    double best = 0.0;
+    for (int repetition = 0; repetition < repetitions; ++repetition)
+    {
+      const auto start = Clock::now();
+      for (size_t i = 0; i < iterations; ++i)
+      {
+        body();
+      }
+      const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double)iterations;
+      best = repetition == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+  }
+
+  /** @brief Publish cost of DataBroker against the map of std::function it replaced, 1 to 64 subscribers. */
+  int RunBrokerBenchmark();
+
+  /** @brief Sort and scan of 20, 60 and 200 cars, as an array of PlayerData and as a FieldTable. */
+  int RunFieldTableBenchmark();
+
+  /** @brief CPU and wakeups of the UDP receiving thread at 1 and 10 kHz, receiving with recvmmsg() and io_uring. */
+  int RunUdpReceiveBenchmark();
+
+  /** @brief RelativeTimingEngine updates for 200 cars at 100 Hz, against sorting the cars from scratch each tick. */
+  int RunRelativeTimingBenchmark();
+
+  /** @brief Frame CPU time of the input graph at 200, 2,000 and 20,000 samples, line by line and from TraceGraphBuffer. */
+  int RunInputGraphBenchmark();
+} // namespace pacemaker::benchmarks
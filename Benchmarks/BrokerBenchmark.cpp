@@ -0,0 +1,66 @@
+#include "Benchmarks.h"
+
+#include <Data/DataBroker.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <unordered_map>
+
+namespace pacemaker::benchmarks
+{
+
+namespace
+{
+  constexpr size_t PUBLISHES = 200000;
+
+  /** @brief The broker's fan-out before subscribers moved into a contiguous Delegate table. */
+  class MapBroker
+  {
+  public:
+    void Subscribe(std::function<void(const int&)> callback) { m_subscribers[m_nextId++] = std::move(callback); }
+
+    void Publish(const int& data)
+    {
+      m_latestData = data;
+      for (const auto& [id, callback] : m_subscribers)
+      {
+        callback(data);
+      }
+    }
+
+  private:
+    std::unordered_map<size_t, std::function<void(const int&)>> m_subscribers;
+    size_t m_nextId = 0;
+    int m_latestData = 0;
+  };
+} // namespace
+
+//------------------------------------------------------------------------------
+int RunBrokerBenchmark()
+{
+  std::printf("ns per publish of an int, each subscriber increments a counter\n");
+  std::printf("  subscribers  std::function map  DataBroker\n");
+  for (size_t subscribers = 1; subscribers <= 64; subscribers *= 2)
+  {
+    uint64_t delivered = 0;
+
+    MapBroker mapBroker;
+    DataBroker<int> broker;
+    for (size_t i = 0; i < subscribers; ++i)
+    {
+      mapBroker.Subscribe([&delivered](const int&) { ++delivered; });
+      (void)broker.Subscribe([&delivered](const int&) { ++delivered; });
+    }
+
+    int value = 0;
+    const double mapNs = MeasureNs(PUBLISHES, [&] { mapBroker.Publish(++value); });
+    const double brokerNs = MeasureNs(PUBLISHES, [&] { broker.Publish(++value); });
+    KeepAlive(delivered);
+
+    std::printf("  %11zu  %17.1f  %10.1f\n", subscribers, mapNs, brokerNs);
+  }
+  return EXIT_SUCCESS;
+}
+
+} // namespace pacemaker::benchmarks
@@ -0,0 +1,124 @@
+#include "Benchmarks.h"
+
+#include <Data/DataStructs.h>
+#include <Data/FieldTable.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace pacemaker::benchmarks
+{
+
+namespace
+{
+  constexpr size_t ITERATIONS = 20000;
+
+  /** @brief Builds a grid of cars in a random running order, a few of them in the pit. */
+  std::vector<PlayerData> MakeGrid(size_t cars, std::mt19937& random)
+  {
+    std::vector<int> positions(cars);
+    std::iota(positions.begin(), positions.end(), 1);
+    std::shuffle(positions.begin(), positions.end(), random);
+
+    std::uniform_int_distribution<TimeMs> lapTime(88000, 95000);
+    std::vector<PlayerData> players(cars);
+    for (size_t i = 0; i < cars; ++i)
+    {
+      PlayerData& player = players[i];
+      player.position = positions[i];
+      player.number = static_cast<int>(i) + 1;
+      player.name = StringTable::Instance().Intern("Driver " + std::to_string(i + 1));
+      player.currentTime = lapTime(random);
+      player.bestTime = i % 7 == 0 ? NO_TIME : lapTime(random);
+      player.gap = (positions[i] - 1) * 850;
+      player.teamColorIndex = static_cast<int>(i % 10);
+      player.batteryPercent = static_cast<int>(i * 37 % 100);
+      player.inPit = i % 13 == 0;
+    }
+    return players;
+  }
+
+  /** @brief Scans the array of structs like FieldTable::CountInPit() and FastestBestTime() scan their columns. */
+  size_t CountInPit(const std::vector<PlayerData>& players)
+  {
+    size_t count = 0;
+    for (const auto& player : players)
+    {
+      count += player.inPit ? 1 : 0;
+    }
+    return count;
+  }
+
+  TimeMs FastestBestTime(const std::vector<PlayerData>& players)
+  {
+    TimeMs fastest = NO_TIME;
+    for (const auto& player : players)
+    {
+      if (player.bestTime != NO_TIME && (fastest == NO_TIME || player.bestTime < fastest))
+      {
+        fastest = player.bestTime;
+      }
+    }
+    return fastest;
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+int RunFieldTableBenchmark()
+{
+  std::printf("ns per operation; sort restores the shuffled grid and sorts it by position, scan counts cars in the pit\n");
+  std::printf("and finds the fastest best lap\n");
+  std::printf("  cars  sort AoS  sort FieldTable  scan AoS  scan FieldTable\n");
+
+  std::mt19937 random(8);
+  for (size_t cars : { 20, 60, 200 })
+  {
+    const std::vector<PlayerData> shuffled = MakeGrid(cars, random);
+    FieldTable shuffledTable;
+    shuffledTable.Assign(shuffled);
+
+    std::vector<PlayerData> players;
+    FieldTable table;
+
+    const double sortAosNs = MeasureNs(ITERATIONS, [&] {
+      players = shuffled;
+      std::stable_sort(players.begin(), players.end(),
+        [](const PlayerData& a, const PlayerData& b) { return a.position < b.position; });
+    });
+    const double sortTableNs = MeasureNs(ITERATIONS, [&] {
+      table = shuffledTable;
+      table.SortByPosition();
+    });
+
+    if (!std::is_sorted(players.begin(), players.end(), [](const PlayerData& a, const PlayerData& b) { return a.position < b.position; })
+      || !std::is_sorted(table.Positions().begin(), table.Positions().end()))
+    {
+      std::fprintf(stderr, "Grid of %zu cars is not sorted\n", cars);
+      return EXIT_FAILURE;
+    }
+
+    size_t sink = 0;
+    const double scanAosNs = MeasureNs(ITERATIONS, [&] {
+      sink += CountInPit(players) + static_cast<size_t>(FastestBestTime(players));
+    });
+    const double scanTableNs = MeasureNs(ITERATIONS, [&] {
+      sink += table.CountInPit() + static_cast<size_t>(table.FastestBestTime());
+    });
+    KeepAlive(sink);
+
+    if (CountInPit(players) != table.CountInPit() || FastestBestTime(players) != table.FastestBestTime())
+    {
+      std::fprintf(stderr, "Scans of %zu cars disagree\n", cars);
+      return EXIT_FAILURE;
+    }
+
+    std::printf("  %4zu  %8.1f  %15.1f  %8.1f  %15.1f\n", cars, sortAosNs, sortTableNs, scanAosNs, scanTableNs);
+  }
+  return EXIT_SUCCESS;
+}
+
+} // namespace pacemaker::benchmarks
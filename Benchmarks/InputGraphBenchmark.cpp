@@ -0,0 +1,175 @@
+#include "Benchmarks.h"
+
+#include <Utils/TraceGraphBuffer.h>
+
+#include <raylib.h>
+#include <rlgl.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace pacemaker::benchmarks
+{
+
+namespace
+{
+  constexpr int FRAMES = 300;
+  constexpr int WINDOW_WIDTH = 1280;
+  constexpr int WINDOW_HEIGHT = 400;
+  constexpr size_t TRACE_COUNT = 3; // Throttle, brake, steering, as the input overlay draws them
+  constexpr float THICKNESSES[TRACE_COUNT] = { 2.0f, 2.0f, 1.5f };
+
+  /** @brief Throttle, brake and steering of the nth sample, moving like a lap of inputs. */
+  void MakeSample(size_t n, float (&values)[TRACE_COUNT])
+  {
+    const float t = (float)n * 0.01f;
+    values[0] = 0.5f + 0.5f * std::sin(t);
+    values[1] = std::max(0.0f, -std::sin(t * 0.7f));
+    values[2] = 0.8f * std::sin(t * 1.3f);
+  }
+
+  /** @brief The input overlay's traces as they were drawn before the vertex buffer: one DrawLineEx() per segment. */
+  class LineByLineGraph
+  {
+  public:
+    explicit LineByLineGraph(size_t capacity)
+      : m_capacity(capacity)
+    {
+      for (auto& trace : m_history)
+      {
+        trace.assign(capacity, 0.0f);
+      }
+    }
+
+    void Push(const float (&values)[TRACE_COUNT])
+    {
+      for (size_t trace = 0; trace < TRACE_COUNT; ++trace)
+      {
+        m_history[trace][m_next] = values[trace];
+      }
+      m_next = (m_next + 1) % m_capacity;
+    }
+
+    void Draw(float left, float step, const TraceGraphBuffer::TraceLayout (&layouts)[TRACE_COUNT]) const
+    {
+      const Color colors[TRACE_COUNT] = { GREEN, RED, SKYBLUE };
+      for (size_t i = 1; i < m_capacity; ++i)
+      {
+        const size_t previous = (m_next + i - 1) % m_capacity;
+        const size_t current = (m_next + i) % m_capacity;
+        const float x1 = left + (float)(i - 1) * step;
+        const float x2 = left + (float)i * step;
+        for (size_t trace = 0; trace < TRACE_COUNT; ++trace)
+        {
+          const float y1 = layouts[trace].baseline + m_history[trace][previous] * layouts[trace].scale;
+          const float y2 = layouts[trace].baseline + m_history[trace][current] * layouts[trace].scale;
+          DrawLineEx({ x1, y1 }, { x2, y2 }, THICKNESSES[trace], colors[trace]);
+        }
+      }
+    }
+
+  private:
+    size_t m_capacity;
+    size_t m_next = 0; // Slot of the oldest sample, overwritten by the next one
+    std::vector<float> m_history[TRACE_COUNT];
+  };
+
+  /**
+   * @brief Draws FRAMES frames, each pushing one sample and drawing the graph, and times the CPU side of pushing,
+   *        drawing and handing raylib's batch to the driver. Presenting the frame is not timed.
+   * @return Milliseconds per frame.
+   */
+  template<typename Frame>
+  double MeasureFrameMs(Frame&& frame)
+  {
+    double total = 0.0;
+    for (int i = 0; i < FRAMES; ++i)
+    {
+      BeginDrawing();
+      ClearBackground(BLACK);
+      const auto start = Clock::now();
+      frame(i);
+      rlDrawRenderBatchActive();
+      total += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+      EndDrawing();
+    }
+    return total / FRAMES;
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+int RunInputGraphBenchmark()
+{
+  SetTraceLogLevel(LOG_WARNING);
+  SetConfigFlags(FLAG_WINDOW_HIDDEN);
+  InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "PaceMaker Benchmarks");
+  if (!IsWindowReady())
+  {
+    std::fprintf(stderr, "Could not open a window\n");
+    return EXIT_FAILURE;
+  }
+  SetTargetFPS(0);
+
+  const float left = 80.0f;
+  const float width = (float)WINDOW_WIDTH - 2.0f * left;
+  const float bottom = (float)WINDOW_HEIGHT - 20.0f;
+  const float height = (float)WINDOW_HEIGHT - 50.0f;
+  const TraceGraphBuffer::TraceLayout layouts[TRACE_COUNT] = {
+    { bottom, -height },                     // Throttle
+    { bottom, -height },                     // Brake
+    { bottom - height / 2, -height * 0.4f }, // Steering
+  };
+
+  std::printf("CPU ms per frame over %d frames: push one sample, draw throttle, brake and steering\n", FRAMES);
+  std::printf("  samples  DrawLineEx per segment  TraceGraphBuffer\n");
+  for (size_t samples : { 200, 2000, 20000 })
+  {
+    const float step = width / (float)samples;
+    float values[TRACE_COUNT];
+
+    LineByLineGraph lines(samples);
+    TraceGraphBuffer traces(samples, TRACE_COUNT);
+    const Color colors[TRACE_COUNT] = { GREEN, RED, SKYBLUE };
+    for (size_t trace = 0; trace < TRACE_COUNT; ++trace)
+    {
+      traces.SetTrace(trace, colors[trace], THICKNESSES[trace]);
+    }
+
+    // Start from a full history, as after the first seconds of a session
+    for (size_t n = 0; n < samples; ++n)
+    {
+      MakeSample(n, values);
+      lines.Push(values);
+      traces.Push(values);
+    }
+
+    const double linesMs = MeasureFrameMs([&](int frame) {
+      MakeSample(samples + frame, values);
+      lines.Push(values);
+      lines.Draw(left, step, layouts);
+    });
+
+    bool hasGpuObjects = true;
+    const double tracesMs = MeasureFrameMs([&](int frame) {
+      MakeSample(samples + frame, values);
+      traces.Push(values);
+      hasGpuObjects = traces.Draw(left, step, layouts) && hasGpuObjects;
+    });
+    traces.Release();
+
+    if (!hasGpuObjects)
+    {
+      std::printf("  %7zu  %22.3f  not available, needs GLSL 3.30\n", samples, linesMs);
+      continue;
+    }
+    std::printf("  %7zu  %22.3f  %16.3f\n", samples, linesMs, tracesMs);
+  }
+
+  CloseWindow();
+  return EXIT_SUCCESS;
+}
+
+} // namespace pacemaker::benchmarks
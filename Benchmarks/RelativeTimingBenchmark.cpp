@@ -0,0 +1,108 @@
+#include "Benchmarks.h"
+
+#include <Data/DataStructs.h>
+#include <Data/RelativeTimingEngine.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace pacemaker::benchmarks
+{
+
+namespace
+{
+  constexpr size_t CARS = 200;
+  constexpr int TICK_HZ = 100;
+  constexpr size_t TICKS = 10 * 60 * TICK_HZ; // Ten minutes of session
+  constexpr float TRACK_LENGTH = 5800.0f;
+
+  /** @brief Spreads the cars around the lap at racing speeds, each with its own pace. */
+  std::vector<CarTrackState> MakeField(std::mt19937& random)
+  {
+    std::uniform_real_distribution<float> lapDistance(0.0f, 1.0f);
+    std::uniform_real_distribution<float> speed(55.0f, 70.0f);
+    std::vector<CarTrackState> cars(CARS);
+    for (size_t i = 0; i < CARS; ++i)
+    {
+      CarTrackState& car = cars[i];
+      car.position = static_cast<int>(i) + 1;
+      car.number = static_cast<int>(i) + 1;
+      car.name = StringTable::Instance().Intern("Driver " + std::to_string(i + 1));
+      car.teamColorIndex = static_cast<int>(i % 10);
+      car.lapDistance = lapDistance(random);
+      car.speed = speed(random);
+    }
+    return cars;
+  }
+
+  /** @brief Moves the cars on by one tick. Speeds wander, so cars keep overtaking each other and crossing the line. */
+  void Advance(std::vector<CarTrackState>& cars, std::mt19937& random)
+  {
+    std::uniform_real_distribution<float> acceleration(-0.5f, 0.5f);
+    constexpr float TICK_SECONDS = 1.0f / TICK_HZ;
+    for (auto& car : cars)
+    {
+      car.speed = std::clamp(car.speed + acceleration(random), 40.0f, 85.0f);
+      car.lapDistance += car.speed * TICK_SECONDS / TRACK_LENGTH;
+      if (car.lapDistance >= 1.0f)
+      {
+        car.lapDistance -= 1.0f;
+      }
+    }
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+int RunRelativeTimingBenchmark()
+{
+  std::mt19937 random(18);
+  std::vector<CarTrackState> cars = MakeField(random);
+  RelativeTimingEngine engine(TRACK_LENGTH);
+  RelativeTimingData relativeTiming;
+
+  // A full comparison sort of the track order each tick, for scale
+  std::vector<size_t> sorted(CARS);
+
+  // Per tick, for the 99th percentile; the slowest one only shows when the thread was preempted
+  std::vector<double> updateSeconds(TICKS);
+  double sortSeconds = 0.0;
+  for (size_t tick = 0; tick < TICKS; ++tick)
+  {
+    Advance(cars, random);
+
+    auto start = Clock::now();
+    engine.Update(cars, 0, relativeTiming);
+    updateSeconds[tick] = std::chrono::duration<double>(Clock::now() - start).count();
+
+    start = Clock::now();
+    std::iota(sorted.begin(), sorted.end(), size_t{ 0 });
+    std::sort(sorted.begin(), sorted.end(), [&cars](size_t a, size_t b) { return cars[a].lapDistance < cars[b].lapDistance; });
+    sortSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+    KeepAlive(sorted.front());
+  }
+
+  const auto order = engine.GetTrackOrder();
+  if (!std::is_sorted(order.begin(), order.end(), [&cars](size_t a, size_t b) { return cars[a].lapDistance < cars[b].lapDistance; })
+    || relativeTiming.players.size() != 2 * RelativeTimingEngine::DEFAULT_CARS_AROUND + 1)
+  {
+    std::fprintf(stderr, "Relative timing is out of order\n");
+    return EXIT_FAILURE;
+  }
+
+  const double tickBudget = 1.0 / TICK_HZ;
+  const double meanUpdate = std::accumulate(updateSeconds.begin(), updateSeconds.end(), 0.0) / TICKS;
+  const auto percentile99 = updateSeconds.begin() + TICKS * 99 / 100;
+  std::nth_element(updateSeconds.begin(), percentile99, updateSeconds.end());
+  std::printf("%zu cars at %d Hz for %zu ticks\n", CARS, TICK_HZ, TICKS);
+  std::printf("  RelativeTimingEngine::Update  %6.0f ns per tick, 99th percentile %6.0f ns, %.4f %% of the tick\n",
+    meanUpdate * 1e9, *percentile99 * 1e9, 100.0 * meanUpdate / tickBudget);
+  std::printf("  std::sort of the track order  %6.0f ns per tick\n", sortSeconds / TICKS * 1e9);
+  return EXIT_SUCCESS;
+}
+
+} // namespace pacemaker::benchmarks
@@ -0,0 +1,140 @@
+#include "Benchmarks.h"
+
+#include <Data/DataBroker.hpp>
+#include <Data/DataStructs.h>
+#include <DataReader/UdpTelemetryReceiver.h>
+#include <DataReader/UdpTelemetrySender.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace pacemaker::benchmarks
+{
+
+namespace
+{
+  constexpr std::chrono::seconds DURATION{ 3 };
+
+  /** @brief Gets the user and kernel CPU time of the calling thread so far. */
+  double GetThreadCpuSeconds()
+  {
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+    {
+      const auto ticks = [](const FILETIME& time) { return (uint64_t{ time.dwHighDateTime } << 32) | time.dwLowDateTime; };
+      return (double)(ticks(kernel) + ticks(user)) * 100e-9;
+    }
+#else
+    rusage resources{};
+    if (getrusage(RUSAGE_THREAD, &resources) == 0)
+    {
+      return (double)(resources.ru_utime.tv_sec + resources.ru_stime.tv_sec)
+        + (double)(resources.ru_utime.tv_usec + resources.ru_stime.tv_usec) * 1e-6;
+    }
+#endif
+    return 0.0;
+  }
+
+  struct RunResult
+  {
+    bool usedIoUring = false;
+    ReceiverStats stats;
+    double cpuSeconds = 0.0; // Of the receiving thread, over the run
+    double seconds = 0.0;
+  };
+
+  /**
+   * @brief Sends input telemetry at a fixed rate to a receiver on the loopback for DURATION and measures the receiving
+   *        thread. Packets falling behind schedule go out back to back, as TelemetrySim sends them.
+   * @return false if the sockets could not be opened.
+   */
+  bool RunReceiver(bool useIoUring, int rateHz, RunResult& result)
+  {
+    DataBroker<InputTelemetryData> broker;
+    UdpTelemetryReceiver receiver;
+    receiver.Attach(broker, PacketType::InputTelemetry);
+
+    UdpTelemetryReceiver::Options options;
+    options.bindAddress = "127.0.0.1";
+    options.port = 0;
+    options.useIoUring = useIoUring;
+    UdpTelemetrySender sender;
+    if (!receiver.Open(options) || !sender.Open("127.0.0.1", receiver.GetPort()))
+    {
+      return false;
+    }
+    result.usedIoUring = receiver.IsUsingIoUring();
+
+    std::jthread receiving([&](std::stop_token stopToken) {
+      const double start = GetThreadCpuSeconds();
+      receiver.Run(stopToken);
+      result.cpuSeconds = GetThreadCpuSeconds() - start;
+    });
+
+    InputTelemetryData input;
+    const auto interval = std::chrono::nanoseconds(1'000'000'000 / rateHz);
+    const auto start = Clock::now();
+    auto next = start;
+    for (uint64_t sent = 0; Clock::now() - start < DURATION; ++sent)
+    {
+      input.throttle = (float)(sent % 100) / 100.0f;
+      sender.Send(PacketType::InputTelemetry, input);
+      next += interval;
+      std::this_thread::sleep_until(next);
+    }
+
+    // Let the last packets arrive before stopping
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    receiving.request_stop();
+    receiving.join();
+    result.stats = receiver.GetStats();
+    receiver.Close();
+    return true;
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+int RunUdpReceiveBenchmark()
+{
+  std::printf("UdpTelemetryReceiver on the loopback for %llds per row, per second of the receiving thread\n",
+    static_cast<long long>(DURATION.count()));
+  std::printf("  rate Hz  backend   packets  lost  CPU %%  system calls  of them receiving  receive batches\n");
+  for (int rateHz : { 1000, 10000 })
+  {
+    for (bool useIoUring : { false, true })
+    {
+      RunResult result;
+      if (!RunReceiver(useIoUring, rateHz, result))
+      {
+        std::fprintf(stderr, "Could not open the sockets\n");
+        return EXIT_FAILURE;
+      }
+      if (useIoUring && !result.usedIoUring)
+      {
+        std::printf("  %7d  io_uring not available\n", rateHz);
+        continue;
+      }
+
+      // Counted by the receiver: its poll() calls, and its recvmmsg() or io_uring_enter() calls
+      const ReceiverStats& stats = result.stats;
+      std::printf("  %7d  %-8s  %7.0f  %4llu  %5.2f  %12.0f  %16.0f  %15.0f\n", rateHz, result.usedIoUring ? "io_uring" : "recvmmsg",
+        (double)stats.packets / result.seconds, static_cast<unsigned long long>(stats.lost),
+        100.0 * result.cpuSeconds / result.seconds, (double)(stats.waits + stats.receiveCalls) / result.seconds,
+        (double)stats.receiveCalls / result.seconds, (double)stats.batches / result.seconds);
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+} // namespace pacemaker::benchmarks
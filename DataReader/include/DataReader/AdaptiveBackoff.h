@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+
+namespace pacemaker
+{
+  /**
+   * @brief Waiting strategy for a thread polling for work that arrives in bursts, e.g. frames written by a sim.
+   *        Right after work arrived it spins, so the next item is picked up within microseconds. Then it sleeps for
+   *        growing intervals up to maxSleep, which bounds the pickup latency while costing almost no CPU. Once nothing
+   *        arrived for idleTimeout, e.g. the sim is paused, it sleeps idleSleep at a time.
+   *        E.g.:
+   *        AdaptiveBackoff backoff;
+   *        while (running)
+   *        {
+   *          if (Poll()) backoff.Reset(); else backoff.Pause();
+   *        }
+   */
+  class AdaptiveBackoff
+  {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+      std::chrono::microseconds spinDuration{ 50 };    // Busy-waiting after work arrived
+      std::chrono::microseconds minSleep{ 50 };        // First sleep after spinning, doubled each time...
+      std::chrono::microseconds maxSleep{ 500 };       // ...up to this
+      std::chrono::milliseconds idleTimeout{ 1000 };   // Without work for this long the poller counts as idle...
+      std::chrono::milliseconds idleSleep{ 10 };       // ...and sleeps this long between polls
+    };
+
+    AdaptiveBackoff();
+    explicit AdaptiveBackoff(const Options& options);
+    ~AdaptiveBackoff();
+
+    AdaptiveBackoff(const AdaptiveBackoff&) = delete;
+    AdaptiveBackoff& operator=(const AdaptiveBackoff&) = delete;
+
+    /** @brief Records that work arrived; the next Pause() spins again. */
+    void Reset() noexcept;
+
+    /** @brief Waits before the next poll, as long as the time since the last Reset() calls for. */
+    void Pause();
+
+    /**
+     * @brief Gets how long to wait before the next poll without waiting, for pollers that sleep elsewhere, e.g. on an
+     *        IngestExecutor timer. Advances the backoff like Pause().
+     * @return The wait, zero while the poller should spin.
+     */
+    [[nodiscard]] std::chrono::microseconds NextPause() noexcept;
+
+    /** @brief Checks if nothing arrived for idleTimeout. */
+    [[nodiscard]] bool IsIdle() const noexcept;
+
+  private:
+    void Sleep(std::chrono::microseconds duration);
+
+    Options m_options;
+    Clock::time_point m_lastWork;
+    std::chrono::microseconds m_sleep;  // Next sleep while backing off
+
+#ifdef _WIN32
+    void* m_timer = nullptr; // High-resolution waitable timer HANDLE; Sleep() rounds to the scheduler tick otherwise
+#endif
+  };
+} // namespace pacemaker
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <stop_token>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace pacemaker
+{
+  class IngestExecutor;
+
+  /**
+   * @brief Coroutine of an ingestion pipeline, run by an IngestExecutor. The coroutine starts suspended; Spawn() hands
+   *        it to the executor, which resumes it and owns its frame from then on.
+   *        Only waiting for data suspends: a pipeline receives (co_await), then validates, decodes and publishes with
+   *        plain calls, so the one frame allocated per pipeline is the only allocation.
+   */
+  class IngestTask
+  {
+  public:
+    struct promise_type
+    {
+      IngestTask get_return_object() noexcept { return IngestTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      std::suspend_always final_suspend() noexcept { return {}; } // The executor destroys finished frames
+      void return_void() noexcept {}
+      void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    IngestTask() = default;
+    IngestTask(IngestTask&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    IngestTask& operator=(IngestTask&& other) noexcept
+    {
+      if (this != &other)
+      {
+        Reset();
+        m_handle = std::exchange(other.m_handle, nullptr);
+      }
+      return *this;
+    }
+    ~IngestTask() { Reset(); }
+
+    IngestTask(const IngestTask&) = delete;
+    IngestTask& operator=(const IngestTask&) = delete;
+
+    [[nodiscard]] bool IsValid() const noexcept { return static_cast<bool>(m_handle); }
+
+  private:
+    friend class IngestExecutor;
+
+    explicit IngestTask(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {}
+
+    void Reset() noexcept
+    {
+      if (m_handle)
+      {
+        m_handle.destroy();
+        m_handle = nullptr;
+      }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+  };
+
+  /**
+   * @brief Single-threaded executor multiplexing ingestion pipelines, so several sources (sockets, shared memory,
+   *        recordings) share one thread instead of blocking one thread each. Everything a pipeline publishes comes from
+   *        the executor's thread, which makes it the one producer thread of the brokers they feed.
+   *        Pipelines suspend on socket readiness or timers: epoll with a timerfd on Linux, WSAEventSelect and a
+   *        high-resolution waitable timer on Windows, poll() elsewhere.
+   *        E.g.:
+   *        IngestExecutor executor;
+   *        executor.Spawn(receiver.Ingest(executor));
+   *        executor.Spawn(reader.Ingest(executor));
+   *        std::jthread thread([&](std::stop_token stopToken) { executor.Run(stopToken); });
+   */
+  class IngestExecutor
+  {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Counters of an executor. */
+    struct Stats
+    {
+      uint64_t resumes = 0;   // Coroutine resumptions
+      uint64_t waits = 0;     // Times the thread blocked for readiness or a timer
+      uint64_t wakeups = 0;   // Sockets reported readable
+    };
+
+    IngestExecutor();
+    ~IngestExecutor();
+
+    IngestExecutor(const IngestExecutor&) = delete;
+    IngestExecutor& operator=(const IngestExecutor&) = delete;
+
+    /** @brief Adds a pipeline, to be resumed by Run(). Call before Run() or from a pipeline. */
+    void Spawn(IngestTask task);
+
+    /**
+     * @brief Runs the pipelines on the calling thread until all finished or a stop is requested. Pipelines still
+     *        suspended then are destroyed, unwinding their locals.
+     */
+    void Run(std::stop_token stopToken);
+
+    /** @brief Gets the counters; exact once Run() returned. */
+    [[nodiscard]] const Stats& GetStats() const noexcept { return m_stats; }
+
+    /** @brief Awaitable resuming the pipeline once the native socket handle has data to read. */
+    struct ReadableAwaiter
+    {
+      IngestExecutor& executor;
+      std::intptr_t handle;
+
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> coroutine) { executor.WaitReadable(handle, coroutine); }
+      void await_resume() const noexcept {}
+    };
+
+    /** @brief Awaitable resuming the pipeline at a point in time; one in the past just yields to other pipelines. */
+    struct TimerAwaiter
+    {
+      IngestExecutor& executor;
+      Clock::time_point deadline;
+
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(std::coroutine_handle<> coroutine) { executor.WaitUntil(deadline, coroutine); }
+      void await_resume() const noexcept {}
+    };
+
+    [[nodiscard]] ReadableAwaiter Readable(std::intptr_t handle) noexcept { return { *this, handle }; }
+    [[nodiscard]] TimerAwaiter SleepUntil(Clock::time_point deadline) noexcept { return { *this, deadline }; }
+    [[nodiscard]] TimerAwaiter SleepFor(Clock::duration duration) noexcept { return { *this, Clock::now() + duration }; }
+    [[nodiscard]] TimerAwaiter Yield() noexcept { return { *this, Clock::time_point::min() }; }
+
+  private:
+    struct Poller;
+
+    struct Timer
+    {
+      Clock::time_point deadline;
+      std::coroutine_handle<> coroutine;
+
+      bool operator>(const Timer& other) const noexcept { return deadline > other.deadline; }
+    };
+
+    void WaitReadable(std::intptr_t handle, std::coroutine_handle<> coroutine);
+    void WaitUntil(Clock::time_point deadline, std::coroutine_handle<> coroutine);
+    void Wait();
+    void DestroyTasks();
+
+    std::unique_ptr<Poller> m_poller;                       // Platform readiness backend
+    std::vector<std::coroutine_handle<IngestTask::promise_type>> m_tasks; // Owned frames, finished or not
+    std::vector<std::coroutine_handle<>> m_ready;           // Resumed by the next pass
+    std::vector<std::coroutine_handle<>> m_resuming;        // Swapped with m_ready while a pass runs
+    std::vector<Timer> m_timers;                            // Min-heap on the deadline
+    Stats m_stats;
+  };
+} // namespace pacemaker
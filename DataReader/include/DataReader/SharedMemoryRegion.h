@@ -0,0 +1,59 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+namespace pacemaker
+{
+  /**
+   * @brief Named shared memory mapped into this process: a POSIX shared memory object (shm_open) on Linux, a named
+   *        file mapping backed by the paging file on Windows. The creating process writes, other processes map the
+   *        same pages and see every write without a system call. Not thread-safe; one thread owns the mapping.
+   */
+  class SharedMemoryRegion
+  {
+  public:
+    SharedMemoryRegion() = default;
+    ~SharedMemoryRegion();
+
+    SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+    /**
+     * @brief Creates the named region, or opens it if it exists, and maps it writable.
+     *        Existing contents are kept, so a restarted writer can continue where the previous one stopped.
+     * @param name Region name, without the leading '/' POSIX requires.
+     * @param size Size of the region in bytes.
+     * @return false if the region could not be created or mapped.
+     */
+    bool Create(const std::string& name, size_t size);
+
+    /**
+     * @brief Maps an existing region read-only; Size() is the region size.
+     * @return false if no region of that name exists or it could not be mapped.
+     */
+    bool Open(const std::string& name);
+
+    void Close();
+
+    /**
+     * @brief Removes the name of a region, so the next Create() starts from zeroed memory. Processes that have it
+     *        mapped keep their mapping. Windows frees a region with its last handle, so this does nothing there.
+     */
+    static void Remove(const std::string& name);
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_data != nullptr; }
+    [[nodiscard]] size_t Size() const noexcept { return m_size; }
+
+    [[nodiscard]] std::byte* Data() noexcept { return m_data; }
+    [[nodiscard]] const std::byte* Data() const noexcept { return m_data; }
+
+  private:
+    std::byte* m_data = nullptr;
+    size_t m_size = 0;
+
+#ifdef _WIN32
+    void* m_mapping = nullptr;  // HANDLE of the file mapping object, kept opaque so windows.h stays out of headers
+#endif
+  };
+} // namespace pacemaker
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Data/Schema.h>
+#include <DataReader/TelemetryPacket.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Shared-memory telemetry layout. The writer (the sim, or TelemetrySim standing in for it) rewrites the region in
+ * place; readers map it read-only:
+ *
+ *   SharedTelemetryHeader            SHARED_TELEMETRY_HEADER_SIZE bytes
+ *   slot per PacketType              SHARED_TELEMETRY_SLOT_HEADER_SIZE + slotCapacity bytes each
+ *     SharedTelemetrySlot
+ *     payload                        the BinaryCodec encoding of the type's struct, String: SharedStringTable
+ *
+ * Every slot is a seqlock: the writer makes the sequence odd, rewrites the payload and makes it even again. A reader
+ * copies the payload out between two loads of the sequence and keeps the copy only if both loads are the same even
+ * number; otherwise it raced the writer and copies again. Readers never write, so a stalled reader cannot block the
+ * writer. The header's change counter is bumped after every slot update, so an idle reader polls one word.
+ */
+
+namespace pacemaker
+{
+  inline constexpr uint32_t SHARED_TELEMETRY_MAGIC = 0x504D5348; // "PMSH"
+  inline constexpr uint16_t SHARED_TELEMETRY_VERSION = 2; // 2: VehicleData::lapDistance
+  inline constexpr const char* DEFAULT_SHARED_TELEMETRY_NAME = "PaceMakerTelemetry";
+  inline constexpr uint32_t DEFAULT_SHARED_SLOT_CAPACITY = uint32_t{ 64 } << 10;
+
+  static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<int64_t>::is_always_lock_free,
+    "Atomics shared between processes must be lock-free");
+
+  /** @brief Start of the region. The writer stores the magic last, once the rest is initialized. */
+  struct alignas(64) SharedTelemetryHeader
+  {
+    std::atomic<uint32_t> magic;          // SHARED_TELEMETRY_MAGIC once initialized
+    uint16_t version;                     // SHARED_TELEMETRY_VERSION
+    uint16_t slotCount;                   // PACKET_TYPE_COUNT of the writer
+    uint32_t slotCapacity;                // Payload bytes per slot
+    std::atomic<uint32_t> changeCounter;  // Bumped after every slot update
+  };
+
+  /** @brief Seqlock guarding one slot's payload. */
+  struct alignas(64) SharedTelemetrySlot
+  {
+    std::atomic<uint32_t> sequence;       // Odd while the writer rewrites the slot
+    std::atomic<uint32_t> size;           // Payload bytes, only meaningful under an even sequence
+    std::atomic<int64_t> timestampNs;     // Writer's steady clock when the payload was written
+  };
+
+  inline constexpr size_t SHARED_TELEMETRY_HEADER_SIZE = sizeof(SharedTelemetryHeader);
+  inline constexpr size_t SHARED_TELEMETRY_SLOT_HEADER_SIZE = sizeof(SharedTelemetrySlot);
+
+  /** @brief Gets the size of a region holding slotCount slots of slotCapacity payload bytes. */
+  [[nodiscard]] constexpr size_t SharedTelemetrySize(size_t slotCount, size_t slotCapacity) noexcept
+  {
+    return SHARED_TELEMETRY_HEADER_SIZE + slotCount * (SHARED_TELEMETRY_SLOT_HEADER_SIZE + slotCapacity);
+  }
+
+  /** @brief Gets the offset of a slot's SharedTelemetrySlot; its payload follows it. */
+  [[nodiscard]] constexpr size_t SharedTelemetrySlotOffset(size_t slot, size_t slotCapacity) noexcept
+  {
+    return SHARED_TELEMETRY_HEADER_SIZE + slot * (SHARED_TELEMETRY_SLOT_HEADER_SIZE + slotCapacity);
+  }
+
+#define PACEMAKER_SHARED_STRING_TABLE_SCHEMA(FIELD, ARRAY, LIST)                                                       \
+  LIST(TelemetryStringEntry, strings, "Every string the writer interned, in id order")
+
+  PACEMAKER_SCHEMA_STRUCT(SharedStringTable, PACEMAKER_SHARED_STRING_TABLE_SCHEMA)
+} // namespace pacemaker
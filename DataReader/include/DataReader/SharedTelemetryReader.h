@@ -0,0 +1,176 @@
+#pragma once
+
+#include <Data/BinaryCodec.h>
+#include <Data/DataBroker.hpp>
+#include <Data/StringRemap.h>
+#include <DataReader/AdaptiveBackoff.h>
+#include <DataReader/IngestExecutor.h>
+#include <DataReader/SharedMemoryRegion.h>
+#include <DataReader/SharedTelemetryLayout.h>
+#include <Utils/Delegate.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /** @brief Counters of a shared-memory telemetry reader. */
+  struct SharedReaderStats
+  {
+    uint64_t frames = 0;     // Slot updates copied out, decoded and published, including the string table
+    uint64_t torn = 0;       // Copies discarded because the writer rewrote the slot meanwhile
+    uint64_t malformed = 0;  // Consistent copies that failed to decode
+    uint64_t polls = 0;      // Checks of the change counter
+  };
+
+  /**
+   * @brief Reads telemetry a sim rewrites in place in shared memory (see DataReader/SharedTelemetryLayout.h) and
+   *        publishes each new frame to the brokers, taking the place of the local telemetry producer. Start() runs it
+   *        on a thread of its own; Open() and Run() on one of the caller's; Open() and Ingest() on an IngestExecutor
+   *        shared with other sources.
+   *        Frames are copied out under the slots' seqlocks, so a published value is never torn. The thread polls with
+   *        an AdaptiveBackoff: it picks up frames well within a millisecond while the sim runs and sleeps when it is
+   *        paused. A region that does not exist yet is opened once the sim creates it.
+   *        E.g.:
+   *        SharedTelemetryReader reader;
+   *        reader.Attach(vehicleBroker, PacketType::Vehicle);
+   *        reader.Start();
+   */
+  class SharedTelemetryReader
+  {
+  public:
+    struct Options
+    {
+      std::string name = DEFAULT_SHARED_TELEMETRY_NAME;
+      AdaptiveBackoff::Options backoff;
+      std::chrono::milliseconds reopenInterval{ 500 }; // Retry interval while the region does not exist
+      int maxReadAttempts = 16;                        // Copies tried per slot before waiting for the next change
+    };
+
+    SharedTelemetryReader() = default;
+    ~SharedTelemetryReader();
+
+    SharedTelemetryReader(const SharedTelemetryReader&) = delete;
+    SharedTelemetryReader& operator=(const SharedTelemetryReader&) = delete;
+
+    /**
+     * @brief Publishes the frames of a type to a broker. Call before Open() or Start().
+     * @param broker Broker to publish to; must outlive the reader. The reading thread becomes its producer thread.
+     * @param type Slot type, whose payloads decode to T.
+     */
+    template<typename T>
+    void Attach(DataBroker<T>& broker, PacketType type)
+    {
+      const auto slot = static_cast<size_t>(type);
+      if (m_isOpen || type == PacketType::String || slot >= PACKET_TYPE_COUNT)
+      {
+        return;
+      }
+
+      m_channels[slot].publish = [this, &broker, value = std::make_unique<T>()](std::span<const std::byte> payload) {
+        if (BinaryCodec::Decode(payload, *value) != payload.size())
+        {
+          return false;
+        }
+        if (!m_strings.IsIdentity())
+        {
+          m_strings.Apply(*value);
+        }
+        broker.Publish(*value);
+        return true;
+      };
+    }
+
+    /**
+     * @brief Prepares reading, for a thread of the caller's to Run(). The region itself is mapped by Run(), as soon as
+     *        it exists.
+     * @return false if the reader is already open.
+     */
+    bool Open(const Options& options);
+
+    /** @brief Reads and publishes frames on the calling thread until a stop is requested. */
+    void Run(std::stop_token stopToken);
+
+    /**
+     * @brief Reads and publishes frames as a pipeline of the executor, waiting on its timers between polls.
+     *        Takes the place of Run(); the executor's thread becomes the brokers' producer thread.
+     */
+    [[nodiscard]] IngestTask Ingest(IngestExecutor& executor);
+
+    /** @brief Unmaps the region; Run() must have returned. */
+    void Close();
+
+    /**
+     * @brief Opens the reader and runs it on a thread of its own.
+     * @return false if the reader is already running.
+     */
+    bool Start(const Options& options);
+    bool Start() { return Start(Options{}); }
+
+    /** @brief Stops the reading thread and unmaps the region. */
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const noexcept { return m_thread.joinable(); }
+
+    /** @brief Checks if the region is mapped, i.e. a writer has created it. */
+    [[nodiscard]] bool IsConnected() const noexcept { return m_connected.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the counters; exact once Run() returned, approximate while running. */
+    [[nodiscard]] SharedReaderStats GetStats() const noexcept;
+
+  private:
+    enum class PollResult
+    {
+      Disconnected, // The region does not exist yet
+      Unchanged,
+      Read,
+    };
+
+    enum class ReadResult
+    {
+      Unchanged,
+      Copied,
+      Torn,
+    };
+
+    struct Channel
+    {
+      Delegate<bool(std::span<const std::byte>)> publish; // Decodes a payload and publishes it, empty if not attached
+      uint32_t lastSequence = 0;                          // Sequence of the payload published last
+    };
+
+    PollResult PollRegion();
+    bool TryOpen();
+    bool ReadSlots();
+    ReadResult ReadSlot(size_t slot, Channel& channel);
+    bool UpdateStrings(std::span<const std::byte> payload);
+
+    Options m_options;
+    std::array<Channel, PACKET_TYPE_COUNT> m_channels;
+
+    // Reading thread
+    SharedMemoryRegion m_region;
+    uint32_t m_slotCapacity = 0;
+    uint32_t m_lastChange = 0;          // Change counter seen last
+    std::vector<std::byte> m_copy;      // Payload copied out of a slot
+    StringRemap m_strings;              // Writer id to local id
+    SharedStringTable m_stringTable;    // Reused, allocates only as the writer's table grows
+
+    bool m_isOpen = false;
+    std::atomic<bool> m_connected{ false };
+    std::atomic<uint64_t> m_frames{ 0 };
+    std::atomic<uint64_t> m_torn{ 0 };
+    std::atomic<uint64_t> m_malformed{ 0 };
+    std::atomic<uint64_t> m_polls{ 0 };
+
+    std::jthread m_thread;
+  };
+} // namespace pacemaker
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Data/BinaryCodec.h>
+#include <DataReader/SharedMemoryRegion.h>
+#include <DataReader/SharedTelemetryLayout.h>
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /**
+   * @brief Writes telemetry into a shared-memory region (see DataReader/SharedTelemetryLayout.h) the way a sim does,
+   *        for SharedTelemetryReader to pick up. Strings interned since the previous Write() are published to the
+   *        string slot first, so every id a payload uses can be resolved. One thread writes.
+   *        E.g.:
+   *        SharedTelemetryWriter writer;
+   *        writer.Create(DEFAULT_SHARED_TELEMETRY_NAME);
+   *        writer.Write(PacketType::Vehicle, vehicleData);
+   */
+  class SharedTelemetryWriter
+  {
+  public:
+    SharedTelemetryWriter() = default;
+
+    SharedTelemetryWriter(const SharedTelemetryWriter&) = delete;
+    SharedTelemetryWriter& operator=(const SharedTelemetryWriter&) = delete;
+
+    /**
+     * @brief Creates the region, or takes over the one a previous writer left behind.
+     * @param name Region name.
+     * @param slotCapacity Payload bytes per slot, rounded up to a cache line.
+     * @return false if the region could not be created, or exists with another layout.
+     */
+    bool Create(const std::string& name, uint32_t slotCapacity = DEFAULT_SHARED_SLOT_CAPACITY);
+
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_region.IsOpen(); }
+
+    /**
+     * @brief Rewrites the slot of a type with a value.
+     * @return false if the encoded value does not fit the slot; the slot keeps its previous value then.
+     */
+    template<typename T>
+    bool Write(PacketType type, const T& value)
+    {
+      if (!IsOpen() || type == PacketType::String)
+      {
+        return false;
+      }
+
+      PublishNewStrings();
+      m_buffer.clear();
+      BinaryCodec::Encode(value, m_buffer);
+      return WriteSlot(type, m_buffer);
+    }
+
+  private:
+    void PublishNewStrings();
+    bool WriteSlot(PacketType type, std::span<const std::byte> payload);
+
+    SharedMemoryRegion m_region;
+    uint32_t m_slotCapacity = 0;
+    std::vector<std::byte> m_buffer;  // Value being encoded, reused
+    SharedStringTable m_strings;      // Every string published so far
+  };
+} // namespace pacemaker
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Data/Schema.h>
+#include <Data/StringTable.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * UDP telemetry protocol. Every datagram is one packet, little-endian and encoded with BinaryCodec:
+ *
+ *   TelemetryPacketHeader           TELEMETRY_PACKET_HEADER_SIZE bytes
+ *   payload                         rest of the datagram, the BinaryCodec encoding of the type's struct
+ *
+ * Payloads carry the sender's StringIds. The sender announces each string with a String packet before the first
+ * packet using it and repeats the announcements periodically, so a receiver that joined late or lost one catches up;
+ * ids it has not seen yet read as the empty string until then.
+ */
+
+namespace pacemaker
+{
+  inline constexpr uint32_t TELEMETRY_PACKET_MAGIC = 0x504D5450; // "PMTP"
+  inline constexpr uint16_t TELEMETRY_PACKET_VERSION = 2; // 2: VehicleData::lapDistance
+  inline constexpr uint16_t DEFAULT_TELEMETRY_PORT = 20790;
+
+  // Largest payload a UDP datagram over IPv4 can carry
+  inline constexpr size_t MAX_DATAGRAM_SIZE = 65507;
+
+  /** @brief Type of a telemetry packet, selecting the struct its payload decodes to. */
+  enum class PacketType : uint16_t
+  {
+    String,          // TelemetryStringEntry
+    Leaderboard,     // LeaderboardData
+    RelativeTiming,  // RelativeTimingData
+    TireInfo,        // TireData
+    Vehicle,         // VehicleData
+    InputTelemetry,  // InputTelemetryData
+  };
+
+  inline constexpr size_t PACKET_TYPE_COUNT = static_cast<size_t>(PacketType::InputTelemetry) + 1;
+
+#define PACEMAKER_TELEMETRY_PACKET_HEADER_SCHEMA(FIELD, ARRAY, LIST)                                                   \
+  FIELD(uint32_t, magic, TELEMETRY_PACKET_MAGIC, "TELEMETRY_PACKET_MAGIC")                                             \
+  FIELD(uint16_t, version, TELEMETRY_PACKET_VERSION, "Protocol version")                                               \
+  FIELD(PacketType, type, PacketType::String, "Struct the payload decodes to")                                         \
+  FIELD(uint32_t, sequence, 0, "Per-type sequence number, for loss and reordering detection")                          \
+  FIELD(int64_t, timestampNs, 0, "Sender clock when the packet was sent, only comparable between packets of one sender")
+
+#define PACEMAKER_TELEMETRY_STRING_ENTRY_SCHEMA(FIELD, ARRAY, LIST)                                                    \
+  FIELD(StringId, id, EMPTY_STRING_ID, "Id of the string in the sender's string table")                                \
+  LIST(char, text, "String contents, not null-terminated")
+
+  PACEMAKER_SCHEMA_STRUCT(TelemetryPacketHeader, PACEMAKER_TELEMETRY_PACKET_HEADER_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(TelemetryStringEntry, PACEMAKER_TELEMETRY_STRING_ENTRY_SCHEMA)
+
+  inline constexpr size_t TELEMETRY_PACKET_HEADER_SIZE = 4 + 2 + 2 + 4 + 8;
+} // namespace pacemaker
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /**
+   * @brief Receives the datagrams of a UDP socket through io_uring on Linux. One multishot receive request keeps filling
+   *        buffers provided to the kernel, and completions are read from memory shared with it, so steady-state
+   *        reception makes no receive system calls, only the wait for readiness and one call per half of the buffers
+   *        to give them back.
+   *        Not available on other platforms, on kernels before 6.0 or where io_uring is disabled: Open() fails or
+   *        HasFailed() turns true, and the caller receives with UdpSocket::ReceiveBatch() instead. Kernel headers stay
+   *        out of this header.
+   */
+  class UdpRingReceiver
+  {
+  public:
+    UdpRingReceiver();
+    ~UdpRingReceiver();
+
+    UdpRingReceiver(const UdpRingReceiver&) = delete;
+    UdpRingReceiver& operator=(const UdpRingReceiver&) = delete;
+
+    /**
+     * @brief Sets up the ring and its buffers and starts receiving.
+     * @param socket Bound, non-blocking socket (UdpSocket::GetHandle()); must stay open until Close().
+     * @param bufferCount Number of buffers, at most 32768; datagrams beyond it wait in the socket.
+     * @param bufferSize Size of one buffer; longer datagrams are truncated to it.
+     * @return false if io_uring is not available.
+     */
+    bool Open(std::intptr_t socket, size_t bufferCount, size_t bufferSize);
+
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept;
+
+    /**
+     * @brief Checks if the kernel ended the receive request for good, e.g. because it does not support multishot
+     *        receive; the caller closes the ring and falls back then.
+     */
+    [[nodiscard]] bool HasFailed() const noexcept;
+
+    /** @brief Gets the ring's file descriptor, readable while completions are pending, e.g. to wait on an IngestExecutor. */
+    [[nodiscard]] std::intptr_t GetHandle() const noexcept;
+
+    /**
+     * @brief Waits until completions are pending.
+     * @return false on timeout or error.
+     */
+    bool WaitReadable(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Takes the datagrams received so far, without a system call. The buffers of the previous call are given
+     *        back to the kernel first.
+     * @param datagrams Receives the datagrams, which point into the ring's buffers until the next call.
+     * @return Number of datagrams, 0 if nothing was pending.
+     */
+    size_t ReceiveBatch(std::span<std::span<const std::byte>> datagrams);
+
+    /** @brief Gets the number of io_uring_enter() calls made since Open(), e.g. to give buffers back or to rearm. */
+    [[nodiscard]] uint64_t GetEnterCalls() const noexcept;
+
+  private:
+    struct Ring;
+
+    std::unique_ptr<Ring> m_ring;
+  };
+} // namespace pacemaker
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /**
+   * @brief Non-blocking IPv4 UDP socket with batched receive.
+   *        ReceiveBatch() fills many preallocated slots per call: one recvmmsg() system call on Linux, a drain loop of
+   *        recvfrom() elsewhere. Socket headers stay out of this header.
+   */
+  class UdpSocket
+  {
+  public:
+    UdpSocket();
+    ~UdpSocket();
+
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+
+    /**
+     * @brief Opens the socket and binds it for receiving.
+     * @param address Local IPv4 address to bind, e.g. "0.0.0.0" for all interfaces.
+     * @param port Local port, 0 picks a free one (see GetLocalPort()).
+     * @param receiveBufferBytes Kernel receive buffer size, absorbs bursts while the receiving thread is busy.
+     * @return false if the socket could not be opened or bound.
+     */
+    bool Bind(const char* address, uint16_t port, int receiveBufferBytes);
+
+    /**
+     * @brief Opens the socket for sending to one destination.
+     * @param host IPv4 address of the receiver.
+     * @param port Port of the receiver.
+     * @return false if the socket could not be opened or the address is invalid.
+     */
+    bool Connect(const char* host, uint16_t port);
+
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept;
+
+    /** @brief Gets the native socket handle, e.g. to wait for it on an IngestExecutor. */
+    [[nodiscard]] std::intptr_t GetHandle() const noexcept { return m_socket; }
+
+    /** @brief Gets the local port the socket is bound to. */
+    [[nodiscard]] uint16_t GetLocalPort() const;
+
+    /**
+     * @brief Waits until a datagram can be read.
+     * @return false on timeout or error.
+     */
+    bool WaitReadable(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Receives as many pending datagrams as fit into the slots, without blocking.
+     * @param storage Slot storage, sizes.size() slots of slotSize bytes back to back.
+     * @param slotSize Size of one slot; longer datagrams are truncated and reported with a size above slotSize.
+     * @param sizes Receives the datagram size per filled slot.
+     * @return Number of slots filled, 0 if nothing was pending.
+     */
+    size_t ReceiveBatch(std::span<std::byte> storage, size_t slotSize, std::span<size_t> sizes);
+
+    /** @brief Gets the number of recvmmsg()/recv() calls ReceiveBatch() made, one per batch on Linux. */
+    [[nodiscard]] uint64_t GetReceiveCalls() const noexcept { return m_receiveCalls; }
+
+    /**
+     * @brief Sends one datagram to the connected destination.
+     * @return false if the datagram could not be sent, e.g. because the send buffer is full.
+     */
+    bool Send(std::span<const std::byte> datagram);
+
+  private:
+    struct BatchState;
+
+    bool Open();
+
+    std::intptr_t m_socket; // Native socket handle, SOCKET on Windows, file descriptor elsewhere
+    std::unique_ptr<BatchState> m_batch; // recvmmsg() message headers, sized on first use
+    uint64_t m_receiveCalls = 0;
+  };
+} // namespace pacemaker
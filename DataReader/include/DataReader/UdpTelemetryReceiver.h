@@ -0,0 +1,183 @@
+#pragma once
+
+#include <Data/BinaryCodec.h>
+#include <Data/DataBroker.hpp>
+#include <Data/StringRemap.h>
+#include <DataReader/IngestExecutor.h>
+#include <DataReader/TelemetryPacket.h>
+#include <DataReader/UdpRingReceiver.h>
+#include <DataReader/UdpSocket.h>
+#include <Utils/Delegate.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /** @brief Counters of a UDP telemetry receiver. */
+  struct ReceiverStats
+  {
+    uint64_t packets = 0;       // Packets decoded and published, including string packets
+    uint64_t bytes = 0;         // Datagram bytes received
+    uint64_t batches = 0;       // Batched receive calls that returned packets
+    uint64_t malformed = 0;     // Datagrams that were truncated, of another protocol or failed to decode
+    uint64_t lost = 0;          // Packets missing from the sequence numbers
+    uint64_t stale = 0;         // Packets that arrived after a newer one of their type and were dropped
+    uint64_t waits = 0;         // poll() calls of Run(); Ingest() waits on the executor, which makes them
+    uint64_t receiveCalls = 0;  // recvmmsg()/recv() calls, or io_uring_enter() calls while receiving through io_uring
+  };
+
+  /**
+   * @brief Receives telemetry packets (see DataReader/TelemetryPacket.h) and publishes them to the brokers, taking the
+   *        place of the local telemetry producer. Start() runs it on a thread of its own; Open() and Run() on one of
+   *        the caller's; Open() and Ingest() on an IngestExecutor shared with other sources.
+   *        Datagrams are received in batches into preallocated slots and decoded straight from the slot into one
+   *        persistent value per packet type, so steady-state reception does not allocate. On Linux the slots are
+   *        buffers provided to io_uring, which the kernel fills without receive system calls (see
+   *        DataReader/UdpRingReceiver.h).
+   *        E.g.:
+   *        UdpTelemetryReceiver receiver;
+   *        receiver.Attach(vehicleBroker, PacketType::Vehicle);
+   *        receiver.Start();
+   */
+  class UdpTelemetryReceiver
+  {
+  public:
+    struct Options
+    {
+      std::string bindAddress = "0.0.0.0";
+      uint16_t port = DEFAULT_TELEMETRY_PORT;          // 0 picks a free port, see GetPort()
+      size_t batchSize = 64;                           // Datagrams received per system call at most
+      size_t maxPacketSize = size_t{ 16 } << 10;       // Larger datagrams are dropped as malformed
+      int socketBufferBytes = 4 << 20;                 // Kernel receive buffer, absorbs bursts
+      bool useIoUring = true;                          // Linux: receive through io_uring where the kernel allows it
+    };
+
+    UdpTelemetryReceiver() = default;
+    ~UdpTelemetryReceiver();
+
+    UdpTelemetryReceiver(const UdpTelemetryReceiver&) = delete;
+    UdpTelemetryReceiver& operator=(const UdpTelemetryReceiver&) = delete;
+
+    /**
+     * @brief Publishes the packets of a type to a broker. Call before Open() or Start().
+     * @param broker Broker to publish to; must outlive the receiver. The receiving thread becomes its producer thread.
+     * @param type Packet type, whose payloads decode to T.
+     */
+    template<typename T>
+    void Attach(DataBroker<T>& broker, PacketType type)
+    {
+      const auto slot = static_cast<size_t>(type);
+      if (IsOpen() || type == PacketType::String || slot >= PACKET_TYPE_COUNT)
+      {
+        return;
+      }
+
+      m_channels[slot].publish = [this, &broker, value = std::make_unique<T>()](std::span<const std::byte> payload) {
+        if (BinaryCodec::Decode(payload, *value) != payload.size())
+        {
+          return false;
+        }
+        if (!m_strings.IsIdentity())
+        {
+          m_strings.Apply(*value);
+        }
+        broker.Publish(*value);
+        return true;
+      };
+    }
+
+    /**
+     * @brief Binds the socket and preallocates the receive slots, for a thread of the caller's to Run().
+     * @return false if the socket could not be bound; the receiver stays closed.
+     */
+    bool Open(const Options& options);
+
+    /** @brief Receives and publishes packets on the calling thread until a stop is requested. */
+    void Run(std::stop_token stopToken);
+
+    /**
+     * @brief Receives and publishes packets as a pipeline of the executor, suspended while the socket has no data.
+     *        Takes the place of Run(); the executor's thread becomes the brokers' producer thread.
+     */
+    [[nodiscard]] IngestTask Ingest(IngestExecutor& executor);
+
+    /** @brief Closes the socket; Run() must have returned. */
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_socket.IsOpen(); }
+
+    /**
+     * @brief Opens the receiver and runs it on a thread of its own.
+     * @return false if the socket could not be bound; the receiver stays idle.
+     */
+    bool Start(const Options& options);
+    bool Start() { return Start(Options{}); }
+
+    /** @brief Stops the receiving thread and closes the socket. */
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const noexcept { return m_thread.joinable(); }
+
+    /** @brief Checks if datagrams are received through io_uring rather than with recvmmsg()/recv() calls. */
+    [[nodiscard]] bool IsUsingIoUring() const noexcept { return m_usingIoUring.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the local port the receiver listens on, 0 when closed. */
+    [[nodiscard]] uint16_t GetPort() const { return m_socket.GetLocalPort(); }
+
+    /** @brief Gets the counters; exact once Run() returned, approximate while running. */
+    [[nodiscard]] ReceiverStats GetStats() const noexcept;
+
+  private:
+    struct Channel
+    {
+      Delegate<bool(std::span<const std::byte>)> publish; // Decodes a payload and publishes it, empty if not attached
+      uint32_t lastSequence = 0;
+      int64_t lastTimestampNs = 0;                          // Sender clock of the packet with lastSequence
+      bool hasSequence = false;                             // Nothing received yet, any sequence number is accepted
+    };
+
+    /**
+     * @brief Receives one batch of pending datagrams and publishes them.
+     * @return true if the batch was full, so more may be pending.
+     */
+    bool ReceivePending();
+    size_t ReceiveFromSocket();
+    size_t ReceiveFromRing();
+    [[nodiscard]] std::intptr_t GetWaitHandle() const noexcept { return m_ring.IsOpen() ? m_ring.GetHandle() : m_socket.GetHandle(); }
+    void HandleDatagram(std::span<const std::byte> datagram);
+    bool AcceptSequence(Channel& channel, uint32_t sequence, int64_t timestampNs);
+    bool HandleString(std::span<const std::byte> payload);
+
+    Options m_options;
+    UdpSocket m_socket;
+    UdpRingReceiver m_ring;                 // Open while io_uring receives for the socket
+    std::array<Channel, PACKET_TYPE_COUNT> m_channels;
+
+    // Receiving thread
+    StringRemap m_strings;                  // Sender id to local id
+    TelemetryStringEntry m_stringEntry;     // Reused so string packets only allocate for new strings
+    std::vector<std::byte> m_slots;         // batchSize datagram slots of maxPacketSize bytes, without io_uring
+    std::vector<size_t> m_sizes;            // Datagram size per filled slot
+    std::vector<std::span<const std::byte>> m_datagrams; // Datagrams in the ring's buffers, with io_uring
+
+    std::atomic<bool> m_usingIoUring{ false };
+    std::atomic<uint64_t> m_packets{ 0 };
+    std::atomic<uint64_t> m_bytes{ 0 };
+    std::atomic<uint64_t> m_batches{ 0 };
+    std::atomic<uint64_t> m_malformed{ 0 };
+    std::atomic<uint64_t> m_lost{ 0 };
+    std::atomic<uint64_t> m_stale{ 0 };
+    std::atomic<uint64_t> m_waits{ 0 };
+    std::atomic<uint64_t> m_receiveCalls{ 0 };
+
+    std::jthread m_thread;
+  };
+} // namespace pacemaker
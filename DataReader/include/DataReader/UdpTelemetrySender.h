@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Data/BinaryCodec.h>
+#include <DataReader/TelemetryPacket.h>
+#include <DataReader/UdpSocket.h>
+
+#include <array>
+#include <chrono>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /**
+   * @brief Sends telemetry packets (see DataReader/TelemetryPacket.h) to one UdpTelemetryReceiver.
+   *        Strings interned since the previous Send() are announced first, so the receiver can map every id a payload
+   *        uses. Packets are encoded into one reused buffer; sending does not allocate once it has grown.
+   *        E.g.:
+   *        UdpTelemetrySender sender;
+   *        sender.Open("127.0.0.1", DEFAULT_TELEMETRY_PORT);
+   *        sender.Send(PacketType::Vehicle, vehicleData);
+   */
+  class UdpTelemetrySender
+  {
+  public:
+    UdpTelemetrySender() = default;
+
+    UdpTelemetrySender(const UdpTelemetrySender&) = delete;
+    UdpTelemetrySender& operator=(const UdpTelemetrySender&) = delete;
+
+    /**
+     * @brief Opens the socket for sending to a receiver.
+     * @return false if the socket could not be opened or the address is invalid.
+     */
+    bool Open(const char* host, uint16_t port);
+
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_socket.IsOpen(); }
+
+    /**
+     * @brief Sends one value as a packet of the given type.
+     * @return false if the packet would not fit a datagram or could not be sent.
+     */
+    template<typename T>
+    bool Send(PacketType type, const T& value)
+    {
+      if (!IsOpen())
+      {
+        return false;
+      }
+
+      AnnounceNewStrings();
+      BeginPacket(type);
+      BinaryCodec::Encode(value, m_buffer);
+      return SendPacket();
+    }
+
+    /** @brief Skips the next packet of a type as if it was lost on the way, so the receiver sees a gap; for load tests. */
+    void SkipPacket(PacketType type) { ++m_sequences[static_cast<size_t>(type)]; }
+
+    /**
+     * @brief Announces every string again, for receivers that started late or lost an announcement.
+     *        Worth calling every second or so.
+     */
+    void ResendStrings();
+
+    /** @brief Gets the number of packets that could not be sent. */
+    [[nodiscard]] uint64_t GetFailedCount() const noexcept { return m_failed; }
+
+  private:
+    void AnnounceNewStrings();
+    void SendString(StringId id);
+    void BeginPacket(PacketType type);
+    bool SendPacket();
+
+    UdpSocket m_socket;
+    std::vector<std::byte> m_buffer;                       // Packet being encoded, reused
+    std::array<uint32_t, PACKET_TYPE_COUNT> m_sequences{}; // Next sequence number per type
+    size_t m_stringsAnnounced = 0;                         // Ids below it have been announced
+    TelemetryStringEntry m_stringEntry;                    // Reused so announcements do not allocate
+    std::chrono::steady_clock::time_point m_startTime;
+    uint64_t m_failed = 0;
+  };
+} // namespace pacemaker
@@ -0,0 +1,128 @@
+#include <DataReader/AdaptiveBackoff.h>
+
+#include <algorithm>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace pacemaker
+{
+
+namespace
+{
+  /** @brief Tells the CPU this is a spin-wait loop, freeing resources for the sibling hyper-thread. */
+  void CpuRelax() noexcept
+  {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+AdaptiveBackoff::AdaptiveBackoff()
+  : AdaptiveBackoff(Options{})
+{
+}
+
+//------------------------------------------------------------------------------
+AdaptiveBackoff::AdaptiveBackoff(const Options& options)
+  : m_options(options)
+  , m_lastWork(Clock::now())
+  , m_sleep(options.minSleep)
+{
+#ifdef _WIN32
+  m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+}
+
+//------------------------------------------------------------------------------
+AdaptiveBackoff::~AdaptiveBackoff()
+{
+#ifdef _WIN32
+  if (m_timer)
+  {
+    CloseHandle(m_timer);
+  }
+#endif
+}
+
+//------------------------------------------------------------------------------
+void AdaptiveBackoff::Reset() noexcept
+{
+  m_lastWork = Clock::now();
+  m_sleep = m_options.minSleep;
+}
+
+//------------------------------------------------------------------------------
+void AdaptiveBackoff::Pause()
+{
+  const std::chrono::microseconds pause = NextPause();
+  if (pause.count() > 0)
+  {
+    Sleep(pause);
+    return;
+  }
+
+  for (int i = 0; i < 64; ++i)
+  {
+    CpuRelax();
+  }
+}
+
+//------------------------------------------------------------------------------
+std::chrono::microseconds AdaptiveBackoff::NextPause() noexcept
+{
+  const auto waited = Clock::now() - m_lastWork;
+  if (waited < m_options.spinDuration)
+  {
+    return std::chrono::microseconds(0);
+  }
+
+  if (waited >= m_options.idleTimeout)
+  {
+    return m_options.idleSleep;
+  }
+
+  const std::chrono::microseconds pause = m_sleep;
+  m_sleep = std::min(m_sleep * 2, m_options.maxSleep);
+  return pause;
+}
+
+//------------------------------------------------------------------------------
+bool AdaptiveBackoff::IsIdle() const noexcept
+{
+  return Clock::now() - m_lastWork >= m_options.idleTimeout;
+}
+
+//------------------------------------------------------------------------------
+void AdaptiveBackoff::Sleep(std::chrono::microseconds duration)
+{
+#ifdef _WIN32
+  if (m_timer)
+  {
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -static_cast<LONGLONG>(duration.count()) * 10; // Relative, in 100 ns units
+    if (SetWaitableTimerEx(m_timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+    {
+      WaitForSingleObject(m_timer, INFINITE);
+      return;
+    }
+  }
+#endif
+  std::this_thread::sleep_for(duration);
+}
+
+} // namespace pacemaker
@@ -0,0 +1,455 @@
+#include <DataReader/IngestExecutor.h>
+
+#include <algorithm>
+#include <functional>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <windows.h>
+#pragma comment(lib, "ws2_32.lib")
+#elif defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace pacemaker
+{
+
+namespace
+{
+  using Clock = IngestExecutor::Clock;
+
+  /** @brief A pipeline waiting for a socket, and whether the wait is still pending. */
+  struct Registration
+  {
+    std::intptr_t handle;
+    std::coroutine_handle<> coroutine;
+    bool isArmed;
+#ifdef _WIN32
+    WSAEVENT event;
+#endif
+  };
+} // namespace
+
+#ifdef _WIN32
+/**
+ * @brief Sockets signal an event each via WSAEventSelect(); one WaitForMultipleObjects() covers them, a high-resolution
+ *        waitable timer for the next deadline and the stop event.
+ */
+struct IngestExecutor::Poller
+{
+  HANDLE wake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+  HANDLE timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+  std::vector<Registration> registrations;
+  std::vector<HANDLE> handles;
+
+  ~Poller()
+  {
+    Clear();
+    CloseHandle(wake);
+    if (timer)
+    {
+      CloseHandle(timer);
+    }
+  }
+
+  void Add(std::intptr_t handle, std::coroutine_handle<> coroutine)
+  {
+    auto it = std::find_if(registrations.begin(), registrations.end(), [&](const Registration& r) { return r.handle == handle; });
+    if (it == registrations.end())
+    {
+      // FD_READ is signalled again after each recv() that leaves data behind, and for data pending at registration
+      WSAEVENT event = WSACreateEvent();
+      WSAEventSelect(static_cast<SOCKET>(handle), event, FD_READ);
+      it = registrations.insert(registrations.end(), Registration{ handle, {}, false, event });
+    }
+    it->coroutine = coroutine;
+    it->isArmed = true;
+  }
+
+  void Wait(Clock::time_point deadline, std::vector<std::coroutine_handle<>>& ready, uint64_t& wakeups)
+  {
+    handles.clear();
+    handles.push_back(wake);
+    DWORD timeout = INFINITE;
+    const auto now = Clock::now();
+    if (deadline <= now)
+    {
+      timeout = 0;
+    }
+    else if (deadline != Clock::time_point::max())
+    {
+      const auto due = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+      LARGE_INTEGER dueTime;
+      dueTime.QuadPart = -std::max<LONGLONG>(due / 100, 1); // Relative, in 100 ns units
+      if (timer && SetWaitableTimerEx(timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+      {
+        handles.push_back(timer);
+      }
+      else
+      {
+        timeout = static_cast<DWORD>((due + 999999) / 1000000);
+      }
+    }
+    for (const auto& registration : registrations)
+    {
+      if (registration.isArmed)
+      {
+        handles.push_back(registration.event);
+      }
+    }
+
+    WaitForMultipleObjects(static_cast<DWORD>(handles.size()), handles.data(), FALSE, timeout);
+    for (auto& registration : registrations)
+    {
+      WSANETWORKEVENTS events;
+      if (registration.isArmed && WaitForSingleObject(registration.event, 0) == WAIT_OBJECT_0
+        && WSAEnumNetworkEvents(static_cast<SOCKET>(registration.handle), registration.event, &events) == 0
+        && (events.lNetworkEvents & FD_READ))
+      {
+        registration.isArmed = false;
+        ready.push_back(registration.coroutine);
+        ++wakeups;
+      }
+    }
+  }
+
+  void Wake() { SetEvent(wake); }
+
+  void Clear()
+  {
+    for (const auto& registration : registrations)
+    {
+      WSAEventSelect(static_cast<SOCKET>(registration.handle), nullptr, 0);
+      WSACloseEvent(registration.event);
+    }
+    registrations.clear();
+  }
+};
+#elif defined(__linux__)
+/**
+ * @brief Sockets are registered one-shot with epoll and re-armed per wait; a timerfd carries the next deadline at
+ *        nanosecond resolution and an eventfd the stop request.
+ */
+struct IngestExecutor::Poller
+{
+  int epoll = epoll_create1(EPOLL_CLOEXEC);
+  int timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  int wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  Clock::time_point timerDeadline = Clock::time_point::max(); // Deadline the timerfd is armed with
+  std::vector<Registration> registrations;
+  epoll_event events[16];
+
+  Poller()
+  {
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = static_cast<uint64_t>(timer);
+    epoll_ctl(epoll, EPOLL_CTL_ADD, timer, &event);
+    event.data.u64 = static_cast<uint64_t>(wake);
+    epoll_ctl(epoll, EPOLL_CTL_ADD, wake, &event);
+  }
+
+  ~Poller()
+  {
+    Clear();
+    ::close(wake);
+    ::close(timer);
+    ::close(epoll);
+  }
+
+  void Add(std::intptr_t handle, std::coroutine_handle<> coroutine)
+  {
+    auto it = std::find_if(registrations.begin(), registrations.end(), [&](const Registration& r) { return r.handle == handle; });
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLONESHOT;
+    event.data.u64 = static_cast<uint64_t>(handle);
+    if (it == registrations.end())
+    {
+      epoll_ctl(epoll, EPOLL_CTL_ADD, static_cast<int>(handle), &event);
+      it = registrations.insert(registrations.end(), Registration{ handle, {}, false });
+    }
+    else
+    {
+      epoll_ctl(epoll, EPOLL_CTL_MOD, static_cast<int>(handle), &event);
+    }
+    it->coroutine = coroutine;
+    it->isArmed = true;
+  }
+
+  void Wait(Clock::time_point deadline, std::vector<std::coroutine_handle<>>& ready, uint64_t& wakeups)
+  {
+    int timeout = -1;
+    if (deadline <= Clock::now())
+    {
+      timeout = 0;
+    }
+    else if (deadline != timerDeadline)
+    {
+      // steady_clock is CLOCK_MONOTONIC on Linux; an all-zero value disarms the timer
+      itimerspec spec{};
+      if (deadline != Clock::time_point::max())
+      {
+        const auto since = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+        spec.it_value.tv_sec = static_cast<time_t>(since / 1000000000);
+        spec.it_value.tv_nsec = static_cast<long>(since % 1000000000);
+      }
+      timerfd_settime(timer, TFD_TIMER_ABSTIME, &spec, nullptr);
+      timerDeadline = deadline;
+    }
+
+    const int count = epoll_wait(epoll, events, static_cast<int>(std::size(events)), timeout);
+    for (int i = 0; i < count; ++i)
+    {
+      const auto handle = static_cast<std::intptr_t>(events[i].data.u64);
+      if (handle == timer || handle == wake)
+      {
+        uint64_t value;
+        [[maybe_unused]] const ssize_t drained = ::read(static_cast<int>(handle), &value, sizeof(value));
+        if (handle == timer)
+        {
+          timerDeadline = Clock::time_point::max();
+        }
+        continue;
+      }
+
+      auto it = std::find_if(registrations.begin(), registrations.end(), [&](const Registration& r) { return r.handle == handle; });
+      if (it != registrations.end() && it->isArmed)
+      {
+        it->isArmed = false;
+        ready.push_back(it->coroutine);
+        ++wakeups;
+      }
+    }
+  }
+
+  void Wake()
+  {
+    const uint64_t value = 1;
+    [[maybe_unused]] const ssize_t written = ::write(wake, &value, sizeof(value));
+  }
+
+  void Clear()
+  {
+    for (const auto& registration : registrations)
+    {
+      epoll_ctl(epoll, EPOLL_CTL_DEL, static_cast<int>(registration.handle), nullptr);
+    }
+    registrations.clear();
+  }
+};
+#else
+/** @brief poll() over the waiting sockets and a self-pipe for the stop request, at millisecond resolution. */
+struct IngestExecutor::Poller
+{
+  int wake[2] = { -1, -1 };
+  std::vector<Registration> registrations;
+  std::vector<pollfd> descriptors;
+
+  Poller()
+  {
+    if (::pipe(wake) == 0)
+    {
+      fcntl(wake[0], F_SETFL, fcntl(wake[0], F_GETFL, 0) | O_NONBLOCK);
+      fcntl(wake[1], F_SETFL, fcntl(wake[1], F_GETFL, 0) | O_NONBLOCK);
+    }
+  }
+
+  ~Poller()
+  {
+    ::close(wake[0]);
+    ::close(wake[1]);
+  }
+
+  void Add(std::intptr_t handle, std::coroutine_handle<> coroutine)
+  {
+    auto it = std::find_if(registrations.begin(), registrations.end(), [&](const Registration& r) { return r.handle == handle; });
+    if (it == registrations.end())
+    {
+      it = registrations.insert(registrations.end(), Registration{ handle, {}, false });
+    }
+    it->coroutine = coroutine;
+    it->isArmed = true;
+  }
+
+  void Wait(Clock::time_point deadline, std::vector<std::coroutine_handle<>>& ready, uint64_t& wakeups)
+  {
+    int timeout = -1;
+    const auto now = Clock::now();
+    if (deadline <= now)
+    {
+      timeout = 0;
+    }
+    else if (deadline != Clock::time_point::max())
+    {
+      timeout = static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count());
+    }
+
+    descriptors.clear();
+    descriptors.push_back({ wake[0], POLLIN, 0 });
+    for (const auto& registration : registrations)
+    {
+      if (registration.isArmed)
+      {
+        descriptors.push_back({ static_cast<int>(registration.handle), POLLIN, 0 });
+      }
+    }
+
+    if (::poll(descriptors.data(), static_cast<nfds_t>(descriptors.size()), timeout) <= 0)
+    {
+      return;
+    }
+    if (descriptors[0].revents)
+    {
+      char drained[16];
+      while (::read(wake[0], drained, sizeof(drained)) > 0) {}
+    }
+    for (size_t i = 1; i < descriptors.size(); ++i)
+    {
+      if (!descriptors[i].revents)
+      {
+        continue;
+      }
+      auto it = std::find_if(registrations.begin(), registrations.end(), [&](const Registration& r) { return r.handle == descriptors[i].fd; });
+      it->isArmed = false;
+      ready.push_back(it->coroutine);
+      ++wakeups;
+    }
+  }
+
+  void Wake()
+  {
+    const char value = 1;
+    [[maybe_unused]] const ssize_t written = ::write(wake[1], &value, 1);
+  }
+
+  void Clear() { registrations.clear(); }
+};
+#endif
+
+//------------------------------------------------------------------------------
+IngestExecutor::IngestExecutor()
+  : m_poller(std::make_unique<Poller>())
+{
+}
+
+//------------------------------------------------------------------------------
+IngestExecutor::~IngestExecutor()
+{
+  DestroyTasks();
+}
+
+//------------------------------------------------------------------------------
+void IngestExecutor::Spawn(IngestTask task)
+{
+  if (!task.IsValid())
+  {
+    return;
+  }
+
+  const auto handle = std::exchange(task.m_handle, nullptr);
+  m_tasks.push_back(handle);
+  m_ready.push_back(handle);
+}
+
+//------------------------------------------------------------------------------
+void IngestExecutor::Run(std::stop_token stopToken)
+{
+  m_stats = {};
+  std::stop_callback wakeOnStop(stopToken, [this] { m_poller->Wake(); });
+
+  while (!stopToken.stop_requested())
+  {
+    // Pipelines that suspend during the pass are resumed by the next one, after the poller had its say
+    m_resuming.swap(m_ready);
+    for (const auto coroutine : m_resuming)
+    {
+      coroutine.resume();
+      ++m_stats.resumes;
+    }
+    m_resuming.clear();
+
+    std::erase_if(m_tasks, [](auto task) {
+      if (!task.done())
+      {
+        return false;
+      }
+      task.destroy();
+      return true;
+    });
+    if (m_tasks.empty())
+    {
+      break;
+    }
+
+    Wait();
+  }
+
+  DestroyTasks();
+}
+
+//------------------------------------------------------------------------------
+void IngestExecutor::WaitReadable(std::intptr_t handle, std::coroutine_handle<> coroutine)
+{
+  m_poller->Add(handle, coroutine);
+}
+
+//------------------------------------------------------------------------------
+void IngestExecutor::WaitUntil(Clock::time_point deadline, std::coroutine_handle<> coroutine)
+{
+  m_timers.push_back({ deadline, coroutine });
+  std::push_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+}
+
+//------------------------------------------------------------------------------
+void IngestExecutor::Wait()
+{
+  // Runnable pipelines only let the poller look, without blocking
+  Clock::time_point deadline = Clock::time_point::max();
+  if (!m_ready.empty())
+  {
+    deadline = Clock::time_point::min();
+  }
+  else if (!m_timers.empty())
+  {
+    deadline = m_timers.front().deadline;
+  }
+
+  if (deadline > Clock::now())
+  {
+    ++m_stats.waits;
+  }
+  m_poller->Wait(deadline, m_ready, m_stats.wakeups);
+
+  const auto now = Clock::now();
+  while (!m_timers.empty() && m_timers.front().deadline <= now)
+  {
+    m_ready.push_back(m_timers.front().coroutine);
+    std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+    m_timers.pop_back();
+  }
+}
+
+//------------------------------------------------------------------------------
+void IngestExecutor::DestroyTasks()
+{
+  m_poller->Clear();
+  m_ready.clear();
+  m_resuming.clear();
+  m_timers.clear();
+  for (const auto task : m_tasks)
+  {
+    task.destroy();
+  }
+  m_tasks.clear();
+}
+
+} // namespace pacemaker
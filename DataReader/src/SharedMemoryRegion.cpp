@@ -0,0 +1,172 @@
+#include <DataReader/SharedMemoryRegion.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pacemaker
+{
+
+namespace
+{
+#ifdef _WIN32
+  std::wstring NativeName(const std::string& name)
+  {
+    // Region names are plain ASCII identifiers
+    return std::wstring(name.begin(), name.end());
+  }
+#else
+  std::string NativeName(const std::string& name)
+  {
+    return "/" + name;
+  }
+#endif
+} // namespace
+
+//------------------------------------------------------------------------------
+SharedMemoryRegion::~SharedMemoryRegion()
+{
+  Close();
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRegion::Create(const std::string& name, size_t size)
+{
+  Close();
+  if (size == 0)
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  const auto sizeHigh = static_cast<DWORD>(static_cast<uint64_t>(size) >> 32);
+  const auto sizeLow = static_cast<DWORD>(size);
+  HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, sizeHigh, sizeLow,
+    NativeName(name).c_str());
+  if (!mapping)
+  {
+    return false;
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  if (!view)
+  {
+    CloseHandle(mapping);
+    return false;
+  }
+  m_mapping = mapping;
+#else
+  const int file = ::shm_open(NativeName(name).c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (file < 0)
+  {
+    return false;
+  }
+
+  void* view = MAP_FAILED;
+  if (::ftruncate(file, static_cast<off_t>(size)) == 0)
+  {
+    view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  }
+  ::close(file); // The mapping keeps the object alive
+  if (view == MAP_FAILED)
+  {
+    return false;
+  }
+#endif
+
+  m_data = static_cast<std::byte*>(view);
+  m_size = size;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemoryRegion::Open(const std::string& name)
+{
+  Close();
+
+#ifdef _WIN32
+  HANDLE mapping = OpenFileMappingW(FILE_MAP_READ, FALSE, NativeName(name).c_str());
+  if (!mapping)
+  {
+    return false;
+  }
+
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  MEMORY_BASIC_INFORMATION info{};
+  if (!view || VirtualQuery(view, &info, sizeof(info)) == 0)
+  {
+    if (view)
+    {
+      UnmapViewOfFile(view);
+    }
+    CloseHandle(mapping);
+    return false;
+  }
+  m_mapping = mapping;
+  const size_t size = info.RegionSize; // Rounded up to whole pages
+#else
+  const int file = ::shm_open(NativeName(name).c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (file < 0)
+  {
+    return false;
+  }
+
+  struct stat status{};
+  void* view = MAP_FAILED;
+  if (::fstat(file, &status) == 0 && status.st_size > 0)
+  {
+    view = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+  }
+  ::close(file);
+  if (view == MAP_FAILED)
+  {
+    return false;
+  }
+  const size_t size = static_cast<size_t>(status.st_size);
+#endif
+
+  m_data = static_cast<std::byte*>(view);
+  m_size = size;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SharedMemoryRegion::Close()
+{
+  if (m_data)
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+#else
+    ::munmap(m_data, m_size);
+#endif
+  }
+#ifdef _WIN32
+  if (m_mapping)
+  {
+    CloseHandle(m_mapping);
+    m_mapping = nullptr;
+  }
+#endif
+  m_data = nullptr;
+  m_size = 0;
+}
+
+//------------------------------------------------------------------------------
+void SharedMemoryRegion::Remove(const std::string& name)
+{
+#ifndef _WIN32
+  ::shm_unlink(NativeName(name).c_str());
+#else
+  (void)name;
+#endif
+}
+
+} // namespace pacemaker
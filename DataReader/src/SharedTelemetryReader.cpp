@@ -0,0 +1,272 @@
+#include <DataReader/SharedTelemetryReader.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+SharedTelemetryReader::~SharedTelemetryReader()
+{
+  Stop();
+  Close();
+}
+
+//------------------------------------------------------------------------------
+bool SharedTelemetryReader::Open(const Options& options)
+{
+  if (m_isOpen)
+  {
+    return false;
+  }
+
+  m_options = options;
+  m_frames = 0;
+  m_torn = 0;
+  m_malformed = 0;
+  m_polls = 0;
+  m_isOpen = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SharedTelemetryReader::Close()
+{
+  m_region.Close();
+  m_connected = false;
+  m_isOpen = false;
+}
+
+//------------------------------------------------------------------------------
+bool SharedTelemetryReader::Start(const Options& options)
+{
+  if (IsRunning() || !Open(options))
+  {
+    return false;
+  }
+
+  m_thread = std::jthread([this](std::stop_token stopToken) { Run(stopToken); });
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SharedTelemetryReader::Stop()
+{
+  if (!IsRunning())
+  {
+    return;
+  }
+
+  m_thread.request_stop();
+  m_thread.join();
+  Close();
+}
+
+//------------------------------------------------------------------------------
+SharedReaderStats SharedTelemetryReader::GetStats() const noexcept
+{
+  return {
+    .frames = m_frames.load(std::memory_order_relaxed),
+    .torn = m_torn.load(std::memory_order_relaxed),
+    .malformed = m_malformed.load(std::memory_order_relaxed),
+    .polls = m_polls.load(std::memory_order_relaxed),
+  };
+}
+
+//------------------------------------------------------------------------------
+void SharedTelemetryReader::Run(std::stop_token stopToken)
+{
+  AdaptiveBackoff backoff(m_options.backoff);
+  while (!stopToken.stop_requested())
+  {
+    const PollResult result = PollRegion();
+    if (result == PollResult::Disconnected)
+    {
+      // Sleep in short steps so a stop request is not held up by the retry interval
+      const auto retry = AdaptiveBackoff::Clock::now() + m_options.reopenInterval;
+      while (!stopToken.stop_requested() && AdaptiveBackoff::Clock::now() < retry)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    }
+    else if (result == PollResult::Unchanged)
+    {
+      backoff.Pause();
+    }
+    else
+    {
+      backoff.Reset();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+IngestTask SharedTelemetryReader::Ingest(IngestExecutor& executor)
+{
+  // Shared memory cannot signal readiness, so the backoff's pauses become executor timers. Spinning would keep the
+  // shared thread from blocking at all, so the spin phase becomes the shortest sleep.
+  AdaptiveBackoff backoff(m_options.backoff);
+  while (m_isOpen)
+  {
+    const PollResult result = PollRegion();
+    if (result == PollResult::Disconnected)
+    {
+      co_await executor.SleepFor(m_options.reopenInterval);
+    }
+    else if (result == PollResult::Unchanged)
+    {
+      co_await executor.SleepFor(std::max(backoff.NextPause(), m_options.backoff.minSleep));
+    }
+    else
+    {
+      backoff.Reset();
+      co_await executor.Yield();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+SharedTelemetryReader::PollResult SharedTelemetryReader::PollRegion()
+{
+  if (!m_region.IsOpen() && !TryOpen())
+  {
+    return PollResult::Disconnected;
+  }
+
+  m_polls.fetch_add(1, std::memory_order_relaxed);
+  const auto* header = reinterpret_cast<const SharedTelemetryHeader*>(m_region.Data());
+  const uint32_t change = header->changeCounter.load(std::memory_order_acquire);
+  if (change == m_lastChange)
+  {
+    return PollResult::Unchanged;
+  }
+
+  // A slot the writer kept rewriting is read again with the next poll
+  if (ReadSlots())
+  {
+    m_lastChange = change;
+  }
+  return PollResult::Read;
+}
+
+//------------------------------------------------------------------------------
+bool SharedTelemetryReader::TryOpen()
+{
+  if (!m_region.Open(m_options.name))
+  {
+    return false;
+  }
+
+  // A region still being initialized has no magic yet; it is retried with the next attempt
+  const auto* header = reinterpret_cast<const SharedTelemetryHeader*>(m_region.Data());
+  const bool isValid = m_region.Size() >= SHARED_TELEMETRY_HEADER_SIZE
+    && header->magic.load(std::memory_order_acquire) == SHARED_TELEMETRY_MAGIC
+    && header->version == SHARED_TELEMETRY_VERSION
+    && header->slotCount >= PACKET_TYPE_COUNT
+    && header->slotCapacity % alignof(SharedTelemetrySlot) == 0
+    && m_region.Size() >= SharedTelemetrySize(header->slotCount, header->slotCapacity);
+  if (!isValid)
+  {
+    m_region.Close();
+    return false;
+  }
+
+  m_slotCapacity = header->slotCapacity;
+  m_copy.assign(m_slotCapacity, std::byte{ 0 });
+  m_strings.Clear();
+
+  // Everything in the region is new to this reader, including frames written before it was opened
+  m_lastChange = header->changeCounter.load(std::memory_order_acquire) - 1;
+  for (auto& channel : m_channels)
+  {
+    channel.lastSequence = 0;
+  }
+  m_connected = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool SharedTelemetryReader::ReadSlots()
+{
+  bool isComplete = true;
+
+  // Strings first, so the ids in the payloads read after them can be mapped
+  for (size_t slot = 0; slot < PACKET_TYPE_COUNT; ++slot)
+  {
+    Channel& channel = m_channels[slot];
+    if (slot != static_cast<size_t>(PacketType::String) && !channel.publish)
+    {
+      continue;
+    }
+
+    ReadResult result = ReadResult::Torn;
+    for (int attempt = 0; attempt < m_options.maxReadAttempts && result == ReadResult::Torn; ++attempt)
+    {
+      result = ReadSlot(slot, channel);
+    }
+
+    isComplete = isComplete && result != ReadResult::Torn;
+  }
+  return isComplete;
+}
+
+//------------------------------------------------------------------------------
+SharedTelemetryReader::ReadResult SharedTelemetryReader::ReadSlot(size_t slot, Channel& channel)
+{
+  const std::byte* base = m_region.Data() + SharedTelemetrySlotOffset(slot, m_slotCapacity);
+  const auto* state = reinterpret_cast<const SharedTelemetrySlot*>(base);
+
+  const uint32_t before = state->sequence.load(std::memory_order_acquire);
+  if (before == channel.lastSequence)
+  {
+    return ReadResult::Unchanged;
+  }
+  if (before & 1)
+  {
+    m_torn.fetch_add(1, std::memory_order_relaxed);
+    return ReadResult::Torn;
+  }
+
+  // The copy may race the writer; the size is clamped so a torn size cannot overrun, and the copy is only used if the
+  // sequence did not move. The acquire fence keeps the copy from moving below the second load.
+  const size_t size = std::min<size_t>(state->size.load(std::memory_order_relaxed), m_slotCapacity);
+  std::memcpy(m_copy.data(), base + SHARED_TELEMETRY_SLOT_HEADER_SIZE, size);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (state->sequence.load(std::memory_order_relaxed) != before)
+  {
+    m_torn.fetch_add(1, std::memory_order_relaxed);
+    return ReadResult::Torn;
+  }
+
+  channel.lastSequence = before;
+  const std::span<const std::byte> payload(m_copy.data(), size);
+  const bool isValid = slot == static_cast<size_t>(PacketType::String) ? UpdateStrings(payload)
+    : channel.publish(payload);
+  (isValid ? m_frames : m_malformed).fetch_add(1, std::memory_order_relaxed);
+  return ReadResult::Copied;
+}
+
+//------------------------------------------------------------------------------
+bool SharedTelemetryReader::UpdateStrings(std::span<const std::byte> payload)
+{
+  if (BinaryCodec::Decode(payload, m_stringTable) != payload.size())
+  {
+    return false;
+  }
+
+  // The table only grows while one writer runs; a restarted writer may have reassigned ids, so every entry is checked
+  auto& strings = StringTable::Instance();
+  for (const auto& entry : m_stringTable.strings)
+  {
+    const std::string_view text(entry.text.data(), entry.text.size());
+    if (!m_strings.Contains(entry.id) || strings.View(m_strings.Map(entry.id)) != text)
+    {
+      m_strings.Set(entry.id, strings.Intern(text));
+    }
+  }
+  return true;
+}
+
+} // namespace pacemaker
@@ -0,0 +1,108 @@
+#include <DataReader/SharedTelemetryWriter.h>
+
+#include <chrono>
+#include <cstring>
+#include <string_view>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+bool SharedTelemetryWriter::Create(const std::string& name, uint32_t slotCapacity)
+{
+  Close();
+
+  // Slot headers stay cache-line aligned, so the seqlock words of two slots never share a line
+  slotCapacity = (slotCapacity + 63) & ~uint32_t{ 63 };
+  if (slotCapacity == 0 || !m_region.Create(name, SharedTelemetrySize(PACKET_TYPE_COUNT, slotCapacity)))
+  {
+    return false;
+  }
+
+  // A region left behind by a previous writer with this layout may still be mapped by readers, so its sequences
+  // continue. One with another version or size (on Linux it persists until unlinked) is cleared and laid out anew.
+  auto* header = reinterpret_cast<SharedTelemetryHeader*>(m_region.Data());
+  const bool isSameLayout = header->version == SHARED_TELEMETRY_VERSION && header->slotCount == PACKET_TYPE_COUNT
+    && header->slotCapacity == slotCapacity;
+  if (header->magic.load(std::memory_order_acquire) != SHARED_TELEMETRY_MAGIC || !isSameLayout)
+  {
+    // Zeroed memory is a valid empty slot for every type; readers wait while the magic is missing
+    header->magic.store(0, std::memory_order_release);
+    std::memset(m_region.Data() + SHARED_TELEMETRY_HEADER_SIZE, 0, m_region.Size() - SHARED_TELEMETRY_HEADER_SIZE);
+    header->version = SHARED_TELEMETRY_VERSION;
+    header->slotCount = static_cast<uint16_t>(PACKET_TYPE_COUNT);
+    header->slotCapacity = slotCapacity;
+    header->magic.store(SHARED_TELEMETRY_MAGIC, std::memory_order_release);
+  }
+
+  m_slotCapacity = slotCapacity;
+  m_buffer.reserve(slotCapacity);
+  m_strings.strings.clear();
+
+  // The empty string is known to every reader
+  m_strings.strings.push_back({});
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SharedTelemetryWriter::Close()
+{
+  m_region.Close();
+  m_slotCapacity = 0;
+}
+
+//------------------------------------------------------------------------------
+void SharedTelemetryWriter::PublishNewStrings()
+{
+  // Strings are interned rarely, so this is normally a single atomic load
+  const auto& strings = StringTable::Instance();
+  const size_t count = strings.Size();
+  if (m_strings.strings.size() >= count)
+  {
+    return;
+  }
+
+  while (m_strings.strings.size() < count)
+  {
+    const auto id = static_cast<StringId>(m_strings.strings.size());
+    const std::string_view text = strings.View(id);
+    auto& entry = m_strings.strings.emplace_back();
+    entry.id = id;
+    entry.text.assign(text.begin(), text.end());
+  }
+
+  m_buffer.clear();
+  BinaryCodec::Encode(m_strings, m_buffer);
+  (void)WriteSlot(PacketType::String, m_buffer);
+}
+
+//------------------------------------------------------------------------------
+bool SharedTelemetryWriter::WriteSlot(PacketType type, std::span<const std::byte> payload)
+{
+  if (payload.size() > m_slotCapacity)
+  {
+    return false;
+  }
+
+  std::byte* base = m_region.Data() + SharedTelemetrySlotOffset(static_cast<size_t>(type), m_slotCapacity);
+  auto* slot = reinterpret_cast<SharedTelemetrySlot*>(base);
+  const int64_t timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+  // Odd sequence first; the release fence keeps the payload stores from moving above it
+  const uint32_t sequence = slot->sequence.load(std::memory_order_relaxed) | 1;
+  slot->sequence.store(sequence, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot->size.store(static_cast<uint32_t>(payload.size()), std::memory_order_relaxed);
+  slot->timestampNs.store(timestampNs, std::memory_order_relaxed);
+  std::memcpy(base + SHARED_TELEMETRY_SLOT_HEADER_SIZE, payload.data(), payload.size());
+
+  slot->sequence.store(sequence + 1, std::memory_order_release);
+
+  auto* header = reinterpret_cast<SharedTelemetryHeader*>(m_region.Data());
+  header->changeCounter.fetch_add(1, std::memory_order_release);
+  return true;
+}
+
+} // namespace pacemaker
@@ -0,0 +1,393 @@
+#include <DataReader/UdpRingReceiver.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+#ifdef IORING_RECV_MULTISHOT
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace pacemaker
+{
+
+#ifdef IORING_RECV_MULTISHOT
+namespace
+{
+  constexpr uint16_t BUFFER_GROUP = 0;
+  constexpr uint64_t RECEIVE_TAG = 1;
+  constexpr uint64_t PROVIDE_TAG = 2;
+  constexpr unsigned SUBMISSION_ENTRIES = 16;
+
+  int Setup(unsigned entries, io_uring_params& params)
+  {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+  }
+
+  int Enter(int ring, unsigned submit)
+  {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring, submit, 0, 0, nullptr, 0));
+  }
+
+  /** @brief Loads a ring index the kernel writes. */
+  uint32_t LoadAcquire(uint32_t* value)
+  {
+    return std::atomic_ref<uint32_t>(*value).load(std::memory_order_acquire);
+  }
+
+  /** @brief Publishes a ring index the kernel reads. */
+  void StoreRelease(uint32_t* value, uint32_t newValue)
+  {
+    std::atomic_ref<uint32_t>(*value).store(newValue, std::memory_order_release);
+  }
+
+  /** @brief Maps a part of the ring the kernel shares. */
+  void* MapRing(int ring, size_t size, off_t offset)
+  {
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, offset);
+    return memory == MAP_FAILED ? nullptr : memory;
+  }
+} // namespace
+
+/** @brief The io_uring instance: submission and completion rings, and the buffers provided to the kernel. */
+struct UdpRingReceiver::Ring
+{
+  int fd = -1;
+  int socket = -1;
+
+  void* sqMemory = nullptr;
+  size_t sqSize = 0;
+  void* cqMemory = nullptr;  // Same as sqMemory with IORING_FEAT_SINGLE_MMAP
+  size_t cqSize = 0;
+  io_uring_sqe* sqes = nullptr;
+  size_t sqesSize = 0;
+
+  uint32_t* sqTail = nullptr;
+  uint32_t* sqMask = nullptr;
+  uint32_t* sqArray = nullptr;
+  uint32_t* cqHead = nullptr;
+  uint32_t* cqTail = nullptr;
+  uint32_t* cqMask = nullptr;
+  io_uring_cqe* cqes = nullptr;
+  unsigned sqEntries = 0;
+  unsigned pending = 0;                // Entries queued since the last submission
+
+  size_t bufferCount = 0;
+  size_t bufferSize = 0;
+  std::vector<std::byte> storage;      // The buffers, back to back
+  std::vector<uint16_t> lent;          // Buffers handed out by the last ReceiveBatch()
+  std::vector<uint16_t> released;      // Buffers to give back to the kernel with the next submission
+
+  bool isArmed = false;                // A multishot receive request is active
+  bool hasReceived = false;            // A datagram arrived, so multishot receive is supported
+  bool hasFailed = false;
+  uint64_t enterCalls = 0;
+
+  ~Ring()
+  {
+    if (sqes)
+    {
+      ::munmap(sqes, sqesSize);
+    }
+    if (cqMemory && cqMemory != sqMemory)
+    {
+      ::munmap(cqMemory, cqSize);
+    }
+    if (sqMemory)
+    {
+      ::munmap(sqMemory, sqSize);
+    }
+    if (fd >= 0)
+    {
+      ::close(fd); // Cancels the receive request
+    }
+  }
+
+  bool Initialize()
+  {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = static_cast<uint32_t>(bufferCount * 2); // One completion per buffer, plus errors and rearms
+    fd = Setup(SUBMISSION_ENTRIES, params);
+    if (fd < 0)
+    {
+      return false;
+    }
+
+    sqSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+      sqSize = cqSize = std::max(sqSize, cqSize);
+    }
+    sqMemory = MapRing(fd, sqSize, IORING_OFF_SQ_RING);
+    cqMemory = (params.features & IORING_FEAT_SINGLE_MMAP) ? sqMemory : MapRing(fd, cqSize, IORING_OFF_CQ_RING);
+    sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = static_cast<io_uring_sqe*>(MapRing(fd, sqesSize, IORING_OFF_SQES));
+    if (!sqMemory || !cqMemory || !sqes)
+    {
+      return false;
+    }
+
+    auto* sq = static_cast<std::byte*>(sqMemory);
+    auto* cq = static_cast<std::byte*>(cqMemory);
+    sqTail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    sqMask = reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    sqArray = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    cqHead = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    cqTail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    cqMask = reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    sqEntries = params.sq_entries;
+
+    // Provided buffers: the kernel picks one per datagram, so a buffer is only tied up while a datagram sits in it
+    for (size_t i = 0; i < bufferCount; ++i)
+    {
+      released.push_back(static_cast<uint16_t>(i));
+    }
+    return Submit(true);
+  }
+
+  io_uring_sqe& Queue()
+  {
+    if (pending == sqEntries)
+    {
+      ++enterCalls;
+      Enter(fd, std::exchange(pending, 0u));
+    }
+
+    const uint32_t tail = *sqTail;
+    const uint32_t index = tail & *sqMask;
+    sqArray[index] = index;
+    io_uring_sqe& sqe = sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    StoreRelease(sqTail, tail + 1);
+    ++pending;
+    return sqe;
+  }
+
+  /**
+   * @brief Gives the released buffers back to the kernel, one request per run of consecutive ids, and submits the
+   *        receive request again if it ended; all with one system call in the common case.
+   */
+  bool Submit(bool rearm)
+  {
+    std::sort(released.begin(), released.end());
+    for (size_t first = 0; first < released.size();)
+    {
+      size_t last = first + 1;
+      while (last < released.size() && released[last] == released[last - 1] + 1)
+      {
+        ++last;
+      }
+
+      io_uring_sqe& sqe = Queue();
+      sqe.opcode = IORING_OP_PROVIDE_BUFFERS;
+      sqe.fd = static_cast<int32_t>(last - first);
+      sqe.addr = reinterpret_cast<uint64_t>(storage.data() + released[first] * bufferSize);
+      sqe.len = static_cast<uint32_t>(bufferSize);
+      sqe.off = released[first];
+      sqe.buf_group = BUFFER_GROUP;
+      sqe.flags = IOSQE_CQE_SKIP_SUCCESS;
+      sqe.user_data = PROVIDE_TAG;
+      first = last;
+    }
+    released.clear();
+
+    if (rearm)
+    {
+      io_uring_sqe& sqe = Queue();
+      sqe.opcode = IORING_OP_RECV;
+      sqe.fd = socket;
+      sqe.flags = IOSQE_BUFFER_SELECT;
+      sqe.ioprio = IORING_RECV_MULTISHOT;
+      sqe.buf_group = BUFFER_GROUP;
+      sqe.user_data = RECEIVE_TAG;
+      isArmed = true;
+    }
+
+    ++enterCalls;
+    return Enter(fd, std::exchange(pending, 0u)) >= 0;
+  }
+};
+
+//------------------------------------------------------------------------------
+bool UdpRingReceiver::Open(std::intptr_t socket, size_t bufferCount, size_t bufferSize)
+{
+  Close();
+  if (bufferCount == 0 || bufferCount > 32768 || bufferSize == 0 || bufferSize > UINT32_MAX)
+  {
+    return false;
+  }
+
+  auto ring = std::make_unique<Ring>();
+  ring->socket = static_cast<int>(socket);
+  ring->bufferCount = bufferCount;
+  ring->bufferSize = bufferSize;
+  ring->storage.assign(bufferCount * bufferSize, std::byte{ 0 });
+  ring->lent.reserve(bufferCount);
+  ring->released.reserve(bufferCount);
+  if (!ring->Initialize())
+  {
+    return false;
+  }
+
+  m_ring = std::move(ring);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool UdpRingReceiver::WaitReadable(std::chrono::milliseconds timeout)
+{
+  if (!m_ring)
+  {
+    return false;
+  }
+
+  pollfd descriptor{ m_ring->fd, POLLIN, 0 };
+  return ::poll(&descriptor, 1, static_cast<int>(timeout.count())) > 0;
+}
+
+//------------------------------------------------------------------------------
+size_t UdpRingReceiver::ReceiveBatch(std::span<std::span<const std::byte>> datagrams)
+{
+  if (!m_ring || m_ring->hasFailed)
+  {
+    return 0;
+  }
+  Ring& ring = *m_ring;
+
+  ring.released.insert(ring.released.end(), ring.lent.begin(), ring.lent.end());
+  ring.lent.clear();
+
+  size_t count = 0;
+  uint32_t head = *ring.cqHead;
+  const uint32_t tail = LoadAcquire(ring.cqTail);
+  for (; head != tail && count < datagrams.size(); ++head)
+  {
+    const io_uring_cqe& cqe = ring.cqes[head & *ring.cqMask];
+    if (cqe.user_data != RECEIVE_TAG)
+    {
+      // Giving buffers back only completes on failure, which leaves the kernel short of them; too few end the request
+      continue;
+    }
+    if (!(cqe.flags & IORING_CQE_F_MORE))
+    {
+      ring.isArmed = false;
+    }
+
+    if (cqe.flags & IORING_CQE_F_BUFFER)
+    {
+      const auto id = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+      ring.lent.push_back(id);
+      if (cqe.res >= 0)
+      {
+        datagrams[count++] = std::span<const std::byte>(ring.storage.data() + id * ring.bufferSize,
+          static_cast<size_t>(cqe.res));
+        ring.hasReceived = true;
+      }
+    }
+    else if (cqe.res < 0 && !ring.hasReceived)
+    {
+      // Rejected before the first datagram, e.g. -EINVAL from a kernel without multishot receive
+      ring.hasFailed = true;
+    }
+  }
+  StoreRelease(ring.cqHead, head);
+
+  // Buffers go back once half of them are released, so that costs one system call per many datagrams. Running out of
+  // buffers ends the request; the datagrams wait in the socket until it is submitted again.
+  const bool rearm = !ring.isArmed && head == tail;
+  if (!ring.hasFailed && (rearm || ring.released.size() * 2 >= ring.bufferCount) && !ring.Submit(rearm))
+  {
+    ring.hasFailed = true;
+  }
+  return count;
+}
+
+//------------------------------------------------------------------------------
+bool UdpRingReceiver::HasFailed() const noexcept
+{
+  return m_ring && m_ring->hasFailed;
+}
+
+//------------------------------------------------------------------------------
+std::intptr_t UdpRingReceiver::GetHandle() const noexcept
+{
+  return m_ring ? m_ring->fd : -1;
+}
+
+//------------------------------------------------------------------------------
+uint64_t UdpRingReceiver::GetEnterCalls() const noexcept
+{
+  return m_ring ? m_ring->enterCalls : 0;
+}
+#else
+struct UdpRingReceiver::Ring {};
+
+//------------------------------------------------------------------------------
+bool UdpRingReceiver::Open(std::intptr_t, size_t, size_t)
+{
+  return false;
+}
+
+//------------------------------------------------------------------------------
+bool UdpRingReceiver::WaitReadable(std::chrono::milliseconds)
+{
+  return false;
+}
+
+//------------------------------------------------------------------------------
+size_t UdpRingReceiver::ReceiveBatch(std::span<std::span<const std::byte>>)
+{
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+bool UdpRingReceiver::HasFailed() const noexcept
+{
+  return false;
+}
+
+//------------------------------------------------------------------------------
+std::intptr_t UdpRingReceiver::GetHandle() const noexcept
+{
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+uint64_t UdpRingReceiver::GetEnterCalls() const noexcept
+{
+  return 0;
+}
+#endif
+
+//------------------------------------------------------------------------------
+UdpRingReceiver::UdpRingReceiver() = default;
+
+//------------------------------------------------------------------------------
+UdpRingReceiver::~UdpRingReceiver() = default;
+
+//------------------------------------------------------------------------------
+void UdpRingReceiver::Close()
+{
+  m_ring.reset();
+}
+
+//------------------------------------------------------------------------------
+bool UdpRingReceiver::IsOpen() const noexcept
+{
+  return static_cast<bool>(m_ring);
+}
+
+} // namespace pacemaker
@@ -0,0 +1,277 @@
+#include <DataReader/UdpSocket.h>
+
+#include <algorithm>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace pacemaker
+{
+
+namespace
+{
+#ifdef _WIN32
+  using NativeSocket = SOCKET;
+  constexpr std::intptr_t INVALID_HANDLE = static_cast<std::intptr_t>(INVALID_SOCKET);
+
+  void CloseNative(NativeSocket socket) { closesocket(socket); }
+
+  /** @brief Winsock must be initialized once per process before the first socket is created. */
+  bool InitializeSockets()
+  {
+    static const bool initialized = [] {
+      WSADATA data;
+      return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return initialized;
+  }
+#else
+  using NativeSocket = int;
+  constexpr std::intptr_t INVALID_HANDLE = -1;
+
+  void CloseNative(NativeSocket socket) { ::close(socket); }
+
+  bool InitializeSockets() { return true; }
+#endif
+
+  NativeSocket Native(std::intptr_t handle) { return static_cast<NativeSocket>(handle); }
+
+  bool MakeAddress(const char* host, uint16_t port, sockaddr_in& address)
+  {
+    address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    return inet_pton(AF_INET, host, &address.sin_addr) == 1;
+  }
+} // namespace
+
+#ifdef __linux__
+/** @brief One recvmmsg() call's message headers and buffer vectors, pointing into the caller's slots. */
+struct UdpSocket::BatchState
+{
+  std::vector<mmsghdr> messages;
+  std::vector<iovec> vectors;
+};
+#else
+struct UdpSocket::BatchState {};
+#endif
+
+//------------------------------------------------------------------------------
+UdpSocket::UdpSocket()
+  : m_socket(INVALID_HANDLE)
+{
+}
+
+//------------------------------------------------------------------------------
+UdpSocket::~UdpSocket()
+{
+  Close();
+}
+
+//------------------------------------------------------------------------------
+bool UdpSocket::Open()
+{
+  Close();
+  if (!InitializeSockets())
+  {
+    return false;
+  }
+
+  NativeSocket socket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  m_socket = static_cast<std::intptr_t>(socket);
+  if (m_socket == INVALID_HANDLE)
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  u_long nonBlocking = 1;
+  const bool isNonBlocking = ioctlsocket(socket, FIONBIO, &nonBlocking) == 0;
+#else
+  const bool isNonBlocking = fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK) == 0;
+#endif
+  if (!isNonBlocking)
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool UdpSocket::Bind(const char* address, uint16_t port, int receiveBufferBytes)
+{
+  sockaddr_in local;
+  if (!MakeAddress(address, port, local) || !Open())
+  {
+    return false;
+  }
+
+  // Best effort; the kernel may clamp the size
+  setsockopt(Native(m_socket), SOL_SOCKET, SO_RCVBUF,
+    reinterpret_cast<const char*>(&receiveBufferBytes), sizeof(receiveBufferBytes));
+
+  if (::bind(Native(m_socket), reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0)
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool UdpSocket::Connect(const char* host, uint16_t port)
+{
+  sockaddr_in remote;
+  if (!MakeAddress(host, port, remote) || !Open())
+  {
+    return false;
+  }
+
+  if (::connect(Native(m_socket), reinterpret_cast<const sockaddr*>(&remote), sizeof(remote)) != 0)
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void UdpSocket::Close()
+{
+  if (m_socket != INVALID_HANDLE)
+  {
+    CloseNative(Native(m_socket));
+    m_socket = INVALID_HANDLE;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool UdpSocket::IsOpen() const noexcept
+{
+  return m_socket != INVALID_HANDLE;
+}
+
+//------------------------------------------------------------------------------
+uint16_t UdpSocket::GetLocalPort() const
+{
+  sockaddr_in local{};
+  socklen_t length = sizeof(local);
+  if (!IsOpen() || getsockname(Native(m_socket), reinterpret_cast<sockaddr*>(&local), &length) != 0)
+  {
+    return 0;
+  }
+  return ntohs(local.sin_port);
+}
+
+//------------------------------------------------------------------------------
+bool UdpSocket::WaitReadable(std::chrono::milliseconds timeout)
+{
+  if (!IsOpen())
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  WSAPOLLFD descriptor{ Native(m_socket), POLLRDNORM, 0 };
+  return WSAPoll(&descriptor, 1, static_cast<INT>(timeout.count())) > 0;
+#else
+  pollfd descriptor{ Native(m_socket), POLLIN, 0 };
+  return ::poll(&descriptor, 1, static_cast<int>(timeout.count())) > 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+size_t UdpSocket::ReceiveBatch(std::span<std::byte> storage, size_t slotSize, std::span<size_t> sizes)
+{
+  const size_t slots = std::min(sizes.size(), slotSize > 0 ? storage.size() / slotSize : 0);
+  if (!IsOpen() || slots == 0)
+  {
+    return 0;
+  }
+
+#ifdef __linux__
+  if (!m_batch)
+  {
+    m_batch = std::make_unique<BatchState>();
+  }
+  auto& messages = m_batch->messages;
+  auto& vectors = m_batch->vectors;
+  messages.resize(slots);
+  vectors.resize(slots);
+  for (size_t i = 0; i < slots; ++i)
+  {
+    vectors[i] = { storage.data() + i * slotSize, slotSize };
+    messages[i] = {};
+    messages[i].msg_hdr.msg_iov = &vectors[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  ++m_receiveCalls;
+  const int received = ::recvmmsg(Native(m_socket), messages.data(), static_cast<unsigned int>(slots), MSG_DONTWAIT, nullptr);
+  if (received <= 0)
+  {
+    return 0;
+  }
+
+  for (int i = 0; i < received; ++i)
+  {
+    const bool isTruncated = (messages[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+    sizes[i] = isTruncated ? slotSize + 1 : messages[i].msg_len;
+  }
+  return static_cast<size_t>(received);
+#else
+  // No batched receive call here; drain what is pending, one datagram per call
+  size_t received = 0;
+  while (received < slots)
+  {
+    auto* slot = reinterpret_cast<char*>(storage.data() + received * slotSize);
+    ++m_receiveCalls;
+    const auto result = ::recv(Native(m_socket), slot, static_cast<int>(slotSize), 0);
+    if (result >= 0)
+    {
+      sizes[received++] = static_cast<size_t>(result);
+      continue;
+    }
+
+#ifdef _WIN32
+    if (WSAGetLastError() == WSAEMSGSIZE)
+    {
+      sizes[received++] = slotSize + 1;
+      continue;
+    }
+#endif
+    break; // Would block, or an error; either way nothing more to read now
+  }
+  return received;
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool UdpSocket::Send(std::span<const std::byte> datagram)
+{
+  if (!IsOpen())
+  {
+    return false;
+  }
+
+  const auto* data = reinterpret_cast<const char*>(datagram.data());
+  const auto sent = ::send(Native(m_socket), data, static_cast<int>(datagram.size()), 0);
+  return sent >= 0 && static_cast<size_t>(sent) == datagram.size();
+}
+
+} // namespace pacemaker
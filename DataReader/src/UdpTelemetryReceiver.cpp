@@ -0,0 +1,294 @@
+#include <DataReader/UdpTelemetryReceiver.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+
+namespace pacemaker
+{
+
+namespace
+{
+  // How long the receiving thread waits for data before it checks for a stop request
+  constexpr std::chrono::milliseconds RECEIVE_TIMEOUT{ 100 };
+
+  // A sequence number this far behind the newest one is taken as a restarted sender, not as a late packet
+  constexpr int32_t RESYNC_DISTANCE = 1024;
+
+  // Likewise a packet sent this long before the newest one: the sender's clock starts with it, so after a restart its
+  // timestamps fall back even if it has not sent RESYNC_DISTANCE packets yet. Reordering never delays a packet this long.
+  constexpr int64_t RESYNC_AGE_NS = 1'000'000'000;
+} // namespace
+
+//------------------------------------------------------------------------------
+UdpTelemetryReceiver::~UdpTelemetryReceiver()
+{
+  Stop();
+  Close();
+}
+
+//------------------------------------------------------------------------------
+bool UdpTelemetryReceiver::Open(const Options& options)
+{
+  if (IsOpen() || options.batchSize == 0 || options.maxPacketSize < TELEMETRY_PACKET_HEADER_SIZE)
+  {
+    return false;
+  }
+  if (!m_socket.Bind(options.bindAddress.c_str(), options.port, options.socketBufferBytes))
+  {
+    return false;
+  }
+
+  m_options = options;
+  for (auto& channel : m_channels)
+  {
+    channel.hasSequence = false;
+  }
+  m_strings.Clear();
+
+  // One spare byte per slot tells a datagram of exactly maxPacketSize bytes from a truncated one. Two batches of ring
+  // buffers let the kernel fill the next batch while the current one is decoded.
+  const size_t slotSize = m_options.maxPacketSize + 1;
+  if (!m_options.useIoUring || !m_ring.Open(m_socket.GetHandle(), m_options.batchSize * 2, slotSize))
+  {
+    m_slots.assign(m_options.batchSize * slotSize, std::byte{ 0 });
+  }
+  m_usingIoUring = m_ring.IsOpen();
+  m_sizes.assign(m_options.batchSize, 0);
+  m_datagrams.assign(m_options.batchSize, {});
+
+  m_packets = 0;
+  m_bytes = 0;
+  m_batches = 0;
+  m_malformed = 0;
+  m_lost = 0;
+  m_stale = 0;
+  m_waits = 0;
+  m_receiveCalls = 0;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetryReceiver::Close()
+{
+  m_ring.Close();
+  m_usingIoUring = false;
+  m_socket.Close();
+}
+
+//------------------------------------------------------------------------------
+bool UdpTelemetryReceiver::Start(const Options& options)
+{
+  if (IsRunning() || !Open(options))
+  {
+    return false;
+  }
+
+  m_thread = std::jthread([this](std::stop_token stopToken) { Run(stopToken); });
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetryReceiver::Stop()
+{
+  if (!IsRunning())
+  {
+    return;
+  }
+
+  m_thread.request_stop();
+  m_thread.join();
+  Close();
+}
+
+//------------------------------------------------------------------------------
+ReceiverStats UdpTelemetryReceiver::GetStats() const noexcept
+{
+  return {
+    .packets = m_packets.load(std::memory_order_relaxed),
+    .bytes = m_bytes.load(std::memory_order_relaxed),
+    .batches = m_batches.load(std::memory_order_relaxed),
+    .malformed = m_malformed.load(std::memory_order_relaxed),
+    .lost = m_lost.load(std::memory_order_relaxed),
+    .stale = m_stale.load(std::memory_order_relaxed),
+    .waits = m_waits.load(std::memory_order_relaxed),
+    .receiveCalls = m_receiveCalls.load(std::memory_order_relaxed),
+  };
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetryReceiver::Run(std::stop_token stopToken)
+{
+  while (!stopToken.stop_requested())
+  {
+    m_waits.fetch_add(1, std::memory_order_relaxed);
+    if (!(m_ring.IsOpen() ? m_ring.WaitReadable(RECEIVE_TIMEOUT) : m_socket.WaitReadable(RECEIVE_TIMEOUT)))
+    {
+      continue;
+    }
+
+    // Drain everything pending before waiting again, a full batch at a time
+    while (ReceivePending() && !stopToken.stop_requested())
+    {
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+IngestTask UdpTelemetryReceiver::Ingest(IngestExecutor& executor)
+{
+  while (IsOpen())
+  {
+    co_await executor.Readable(GetWaitHandle());
+
+    // A full batch may have left more behind; the executor's other pipelines get a turn before the next one
+    while (ReceivePending())
+    {
+      co_await executor.Yield();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool UdpTelemetryReceiver::ReceivePending()
+{
+  const size_t received = m_ring.IsOpen() ? ReceiveFromRing() : ReceiveFromSocket();
+  if (received > 0)
+  {
+    m_batches.fetch_add(1, std::memory_order_relaxed);
+  }
+  return received == m_options.batchSize;
+}
+
+//------------------------------------------------------------------------------
+size_t UdpTelemetryReceiver::ReceiveFromSocket()
+{
+  const size_t slotSize = m_options.maxPacketSize + 1;
+  const uint64_t calls = m_socket.GetReceiveCalls();
+  const size_t received = m_socket.ReceiveBatch(m_slots, slotSize, m_sizes);
+  m_receiveCalls.fetch_add(m_socket.GetReceiveCalls() - calls, std::memory_order_relaxed);
+  for (size_t i = 0; i < received; ++i)
+  {
+    const size_t size = std::min(m_sizes[i], slotSize);
+    m_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (m_sizes[i] > m_options.maxPacketSize)
+    {
+      m_malformed.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    HandleDatagram(std::span<const std::byte>(m_slots).subspan(i * slotSize, size));
+  }
+  return received;
+}
+
+//------------------------------------------------------------------------------
+size_t UdpTelemetryReceiver::ReceiveFromRing()
+{
+  const uint64_t calls = m_ring.GetEnterCalls();
+  const size_t received = m_ring.ReceiveBatch(m_datagrams);
+  m_receiveCalls.fetch_add(m_ring.GetEnterCalls() - calls, std::memory_order_relaxed);
+  for (size_t i = 0; i < received; ++i)
+  {
+    const auto datagram = m_datagrams[i];
+    m_bytes.fetch_add(datagram.size(), std::memory_order_relaxed);
+    if (datagram.size() > m_options.maxPacketSize)
+    {
+      m_malformed.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+    HandleDatagram(datagram);
+  }
+
+  // A kernel that rejects multishot receive leaves the datagrams in the socket for the recvmmsg() path
+  if (m_ring.HasFailed())
+  {
+    m_ring.Close();
+    m_usingIoUring = false;
+    m_slots.assign(m_options.batchSize * (m_options.maxPacketSize + 1), std::byte{ 0 });
+  }
+  return received;
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetryReceiver::HandleDatagram(std::span<const std::byte> datagram)
+{
+  TelemetryPacketHeader header;
+  if (datagram.size() < TELEMETRY_PACKET_HEADER_SIZE
+    || BinaryCodec::Decode(datagram, header) != TELEMETRY_PACKET_HEADER_SIZE
+    || header.magic != TELEMETRY_PACKET_MAGIC
+    || header.version != TELEMETRY_PACKET_VERSION
+    || static_cast<size_t>(header.type) >= PACKET_TYPE_COUNT)
+  {
+    m_malformed.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  Channel& channel = m_channels[static_cast<size_t>(header.type)];
+  if (!AcceptSequence(channel, header.sequence, header.timestampNs))
+  {
+    m_stale.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  const auto payload = datagram.subspan(TELEMETRY_PACKET_HEADER_SIZE);
+  bool isValid = true;
+  if (header.type == PacketType::String)
+  {
+    isValid = HandleString(payload);
+  }
+  else if (channel.publish)
+  {
+    isValid = channel.publish(payload);
+  }
+
+  if (isValid)
+  {
+    m_packets.fetch_add(1, std::memory_order_relaxed);
+  }
+  else
+  {
+    m_malformed.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool UdpTelemetryReceiver::AcceptSequence(Channel& channel, uint32_t sequence, int64_t timestampNs)
+{
+  // Signed distance, so wrap-around of the 32-bit counter is just another step forward. A late packet was sent shortly
+  // before the newest one; a sequence number behind with a timestamp that is not is a restarted sender.
+  const auto distance = static_cast<int32_t>(sequence - channel.lastSequence);
+  const auto age = static_cast<int64_t>(static_cast<uint64_t>(channel.lastTimestampNs) - static_cast<uint64_t>(timestampNs));
+  if (channel.hasSequence && distance <= 0 && distance > -RESYNC_DISTANCE && age >= 0 && age < RESYNC_AGE_NS)
+  {
+    return false;
+  }
+
+  if (channel.hasSequence && distance > 1)
+  {
+    m_lost.fetch_add(static_cast<uint64_t>(distance - 1), std::memory_order_relaxed);
+  }
+  channel.lastSequence = sequence;
+  channel.lastTimestampNs = timestampNs;
+  channel.hasSequence = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool UdpTelemetryReceiver::HandleString(std::span<const std::byte> payload)
+{
+  if (BinaryCodec::Decode(payload, m_stringEntry) != payload.size())
+  {
+    return false;
+  }
+
+  // Announcements repeat; only a string not seen under this id, e.g. from a restarted sender, is interned
+  auto& strings = StringTable::Instance();
+  const std::string_view text(m_stringEntry.text.data(), m_stringEntry.text.size());
+  if (m_strings.Contains(m_stringEntry.id) && strings.View(m_strings.Map(m_stringEntry.id)) == text)
+  {
+    return true;
+  }
+  return m_strings.Set(m_stringEntry.id, strings.Intern(text));
+}
+
+} // namespace pacemaker
@@ -0,0 +1,94 @@
+#include <DataReader/UdpTelemetrySender.h>
+
+#include <string_view>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+bool UdpTelemetrySender::Open(const char* host, uint16_t port)
+{
+  if (!m_socket.Connect(host, port))
+  {
+    return false;
+  }
+
+  m_sequences.fill(0);
+  m_startTime = std::chrono::steady_clock::now();
+  m_failed = 0;
+
+  // The empty string is known to every receiver
+  m_stringsAnnounced = EMPTY_STRING_ID + 1;
+  m_buffer.reserve(MAX_DATAGRAM_SIZE);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetrySender::Close()
+{
+  m_socket.Close();
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetrySender::ResendStrings()
+{
+  if (!IsOpen())
+  {
+    return;
+  }
+
+  for (size_t id = EMPTY_STRING_ID + 1; id < m_stringsAnnounced; ++id)
+  {
+    SendString(static_cast<StringId>(id));
+  }
+  AnnounceNewStrings();
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetrySender::AnnounceNewStrings()
+{
+  // Strings are interned rarely, so this is normally a single atomic load
+  const size_t count = StringTable::Instance().Size();
+  while (m_stringsAnnounced < count)
+  {
+    SendString(static_cast<StringId>(m_stringsAnnounced++));
+  }
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetrySender::SendString(StringId id)
+{
+  const std::string_view text = StringTable::Instance().View(id);
+  m_stringEntry.id = id;
+  m_stringEntry.text.assign(text.begin(), text.end());
+
+  BeginPacket(PacketType::String);
+  BinaryCodec::Encode(m_stringEntry, m_buffer);
+  (void)SendPacket();
+}
+
+//------------------------------------------------------------------------------
+void UdpTelemetrySender::BeginPacket(PacketType type)
+{
+  const TelemetryPacketHeader header{
+    .type = type,
+    .sequence = m_sequences[static_cast<size_t>(type)]++,
+    .timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - m_startTime).count(),
+  };
+  m_buffer.clear();
+  BinaryCodec::Encode(header, m_buffer);
+}
+
+//------------------------------------------------------------------------------
+bool UdpTelemetrySender::SendPacket()
+{
+  if (m_buffer.size() > MAX_DATAGRAM_SIZE || !m_socket.Send(m_buffer))
+  {
+    ++m_failed;
+    return false;
+  }
+  return true;
+}
+
+} // namespace pacemaker
@@ -7,8 +7,13 @@
 #include <Widgets/StatusIndicatorWidget.h>
 #include <Data/DataBroker.hpp>
 #include <Data/DataStructs.h>
+#include <Data/LapDeltaEngine.h>
+#include <Recording/SessionRecorder.h>
+#include <Sources/TelemetrySourceManager.h>
+#include <Sources/TestDataSource.h>
+#include <Utils/Config.h>
 #include <Utils/FontManager.h>
-#include <Testing/TestDataGenerator.h>
+#include <Utils/TextCache.h>
 
 #include <raylib.h>
 
@@ -19,6 +24,9 @@
 #include <cmath>
 #include <memory>
 #include <span>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
 
 #pragma comment(linker, "/SUBSYSTEM:WINDOWS /ENTRY:mainCRTStartup")
 
@@ -129,17 +137,148 @@ static std::pair<int, int> InitializeSystem()
   return std::pair<int, int>(monitorWidth, monitorHeight);
 }
 
+/**
+ * @brief Writes the per-topic broker counters to the raylib log: values published, duplicates suppressed by brokers
+ *        with deduplication enabled, values dropped, fan-outs and, with --broker-timing, the time subscriber callbacks
+ *        took.
+ * @param topic Display name of the topic.
+ * @param stats Counters collected by the topic's broker.
+ * @param isTimed true if the broker timed its fan-outs.
+ */
+static void LogBrokerStats(const char* topic, const pacemaker::BrokerStats& stats, bool isTimed)
+{
+  char fanOutTime[48] = "";
+  if (isTimed)
+  {
+    std::snprintf(fanOutTime, sizeof(fanOutTime), ", fan-out time: %.3f ms",
+      std::chrono::duration<double, std::milli>(stats.fanOutTime).count());
+  }
+  TraceLog(LOG_INFO, "BROKER: %-15s published: %llu, suppressed: %llu, dropped: %llu, fan-outs: %llu%s",
+    topic,
+    static_cast<unsigned long long>(stats.published),
+    static_cast<unsigned long long>(stats.suppressed),
+    static_cast<unsigned long long>(stats.dropped),
+    static_cast<unsigned long long>(stats.fanOuts),
+    fanOutTime);
+}
+
+/**
+ * @brief Finds an option on the command line: --name [value].
+ * @param name Option name including the leading dashes.
+ * @param fallback Value used when the option is given without one.
+ * @return The option's value, fallback if it has none, or nullptr if the option was not given.
+ */
+static const char* GetOption(int argc, char* argv[], const char* name, const char* fallback)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], name) == 0)
+    {
+      const bool hasValue = i + 1 < argc && std::strncmp(argv[i + 1], "--", 2) != 0;
+      return hasValue ? argv[i + 1] : fallback;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Writes the recorder counters to the raylib log.
+ * @param stats Counters of the finished recording.
+ */
+static void LogRecorderStats(const pacemaker::RecorderStats& stats)
+{
+  TraceLog(stats.failed ? LOG_WARNING : LOG_INFO, "RECORDER: frames: %llu, bytes: %llu, batches: %llu%s",
+    static_cast<unsigned long long>(stats.frames),
+    static_cast<unsigned long long>(stats.bytes),
+    static_cast<unsigned long long>(stats.batches),
+    stats.failed ? ", stopped early: file could not grow" : "");
+}
+
+/**
+ * @brief Applies the command-line telemetry options over the configuration file's settings:
+ *        --source <names>, --udp [port], --shm [name], --replay <path> [--replay-speed x] [--replay-lap n].
+ *        --udp, --shm and --replay select their sources, which then run together; --source replaces the list.
+ * @param config Configuration to override.
+ */
+static void ApplySourceOptions(int argc, char* argv[], pacemaker::Config& config)
+{
+  std::string sources;
+  if (const char* port = GetOption(argc, argv, "--udp", ""))
+  {
+    sources += "udp,";
+    if (*port)
+    {
+      config.Set("udp.port", port);
+    }
+  }
+
+  if (const char* name = GetOption(argc, argv, "--shm", ""))
+  {
+    sources += "shm,";
+    if (*name)
+    {
+      config.Set("shm.name", name);
+    }
+  }
+
+  if (const char* replayPath = GetOption(argc, argv, "--replay", nullptr))
+  {
+    sources += "replay,";
+    config.Set("replay.path", replayPath);
+  }
+  if (const char* speed = GetOption(argc, argv, "--replay-speed", nullptr))
+  {
+    config.Set("replay.speed", speed);
+  }
+  if (const char* lap = GetOption(argc, argv, "--replay-lap", nullptr))
+  {
+    config.Set("replay.lap", lap);
+  }
+
+  if (const char* source = GetOption(argc, argv, "--source", nullptr))
+  {
+    config.Set("source", source);
+  }
+  else if (!sources.empty())
+  {
+    sources.pop_back();
+    config.Set("source", sources);
+  }
+}
+
 //------------------------------------------------------------------------------
-int main()
+int main(int argc, char* argv[])
 {
   const auto& [monitorWidth, monitorHeight] = InitializeSystem();
 
   using namespace pacemaker;
-  DataBroker<LeaderboardData> leaderboardBroker;
-  DataBroker<RelativeTimingData> relativeTimingBroker;
-  DataBroker<TireInfoData> tireInfoBroker;
-  DataBroker<VehicleData> vehicleBroker;
-  DataBroker<InputTelemetryData> inputTelemetryBroker;
+  DataBroker<LeaderboardData> leaderboardBroker(BrokerMode::Concurrent);
+  DataBroker<RelativeTimingData> relativeTimingBroker(BrokerMode::Concurrent);
+  DataBroker<TireInfoData> tireInfoBroker(BrokerMode::Concurrent);
+  DataBroker<VehicleData> vehicleBroker(BrokerMode::Concurrent);
+  DataBroker<InputTelemetryData> inputTelemetryBroker(BrokerMode::ConcurrentQueued); // Every input sample reaches the render thread
+
+  // Leaderboard updates arrive as row deltas, which the producer applies to its own copy of the latest leaderboard
+  leaderboardBroker.SetDeltaPublishing(true);
+
+  // The delta to the best lap is derived on the ingestion thread from every vehicle sample, whichever source sent it
+  DataBroker<LapDeltaData> lapDeltaBroker(BrokerMode::Concurrent);
+  LapDeltaEngine lapDeltaEngine;
+  vehicleBroker.SetProducerHook([&lapDeltaEngine, &lapDeltaBroker](const VehicleData& vehicle) {
+    if (lapDeltaEngine.Update(vehicle.lapDistance, vehicle.lapTime, vehicle.lastLap))
+    {
+      lapDeltaBroker.Publish(lapDeltaEngine.GetData());
+    }
+  });
+
+  // --broker-timing times every fan-out for the BROKER log lines, at two clock reads per publish
+  const bool brokerTiming = GetOption(argc, argv, "--broker-timing", "") != nullptr;
+  leaderboardBroker.SetFanOutTiming(brokerTiming);
+  relativeTimingBroker.SetFanOutTiming(brokerTiming);
+  tireInfoBroker.SetFanOutTiming(brokerTiming);
+  vehicleBroker.SetFanOutTiming(brokerTiming);
+  inputTelemetryBroker.SetFanOutTiming(brokerTiming);
+  lapDeltaBroker.SetFanOutTiming(brokerTiming);
 
   // Create team colors span
   std::span<const Color> teamColorsSpan(teamColors, 10);
@@ -175,16 +314,28 @@ int main()
     vehicleBroker
   );
 
+  // --input-history <samples> sets how far back the input graph reaches and --input-history-rate <hz> how densely,
+  // 60 samples per second by default; e.g. 30000 at 500 Hz shows a minute
+  const char* inputHistory = GetOption(argc, argv, "--input-history", nullptr);
+  const int inputHistorySize =
+    inputHistory ? std::clamp(std::atoi(inputHistory), 2, 100000) : InputTelemetryData::MAX_HISTORY;
+  const char* inputHistoryRate = GetOption(argc, argv, "--input-history-rate", nullptr);
+  const double inputHistoryRateHz = inputHistoryRate
+    ? std::clamp(std::atof(inputHistoryRate), 1.0, 1000.0)
+    : InputTelemetryOverlay::DEFAULT_HISTORY_RATE_HZ;
+
   auto inputTelemetryOverlay = std::make_unique<InputTelemetryOverlay>(
     Bounds{ monitorWidth / 2 - 550, monitorHeight / 2 - 100, 700, 150 },
     MinSize{ 650, 130 },
     &gFont,
-    inputTelemetryBroker
+    inputTelemetryBroker,
+    static_cast<size_t>(inputHistorySize),
+    inputHistoryRateHz
   );
 
   // Create status indicator widget
   auto statusIndicator = std::make_unique<StatusIndicatorWidget>(
-    Bounds{ monitorWidth / 2 - 315, monitorHeight / 3, 620, 40 },
+    Bounds{ monitorWidth / 2 - 315, monitorHeight / 3, 620, 64 },
     &gFont
   );
   statusIndicator->SetVisible(false);
@@ -198,17 +349,47 @@ int main()
     inputTelemetryOverlay.get()
   };
 
-  // Timing variables
-  float time = 0.0f;
-  float sampleTimer = 0.0f;
+  // Optional session recording of everything the brokers deliver; stopped before the brokers go away
+  SessionRecorder recorder;
+  if (const char* recordingPath = GetOption(argc, argv, "--record", "session.pmrec"))
+  {
+    if (recorder.Start(recordingPath))
+    {
+      recorder.Record(leaderboardBroker, RecordingTopic::Leaderboard);
+      recorder.Record(relativeTimingBroker, RecordingTopic::RelativeTiming);
+      recorder.Record(tireInfoBroker, RecordingTopic::TireInfo);
+      recorder.Record(vehicleBroker, RecordingTopic::Vehicle);
+      recorder.Record(inputTelemetryBroker, RecordingTopic::InputTelemetry);
+      TraceLog(LOG_INFO, "RECORDER: Recording session to %s", recordingPath);
+    }
+    else
+    {
+      TraceLog(LOG_WARNING, "RECORDER: Could not create %s", recordingPath);
+    }
+  }
+
+  // Telemetry is produced off the render thread by the sources the configuration selects (pacemaker.cfg, overridden
+  // by the command line), all on one ingestion thread; declared after the overlays so it is stopped and joined first
+  Config config;
+  const char* configPath = GetOption(argc, argv, "--config", nullptr);
+  config.Load(configPath ? configPath : "pacemaker.cfg");
+  ApplySourceOptions(argc, argv, config);
+
+  TelemetrySourceManager sourceManager(TelemetrySinks{
+    leaderboardBroker, relativeTimingBroker, tireInfoBroker, vehicleBroker, inputTelemetryBroker });
+  if (sourceManager.Start(CreateTelemetrySources(config)) == 0)
+  {
+    TraceLog(LOG_WARNING, "SOURCE: Could not open %s, using test data", config.GetString("source", "generator").c_str());
+    sourceManager.Start(std::make_unique<TestDataSource>());
+  }
+  TraceLog(LOG_INFO, "SOURCE: Running %s", sourceManager.GetSourceNames().c_str());
+
   bool widgetMoveMode = false;
   SetWindowClickThrough(true);
 
   while (!WindowShouldClose())
   {
     float deltaTime = GetFrameTime();
-    time += deltaTime;
-    sampleTimer += deltaTime;
 
     // Toggle move mode with Ctrl+F6
     if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_F6))
@@ -249,31 +430,22 @@ int main()
       }
     }
 
-    // Initialize test data generator
-    TestDataGenerator testDataGenerator;
-
-    { // Update test data
-      testDataGenerator.UpdateInputTelemetryData(time);
-      testDataGenerator.UpdateLeaderboardData(time);
-      testDataGenerator.UpdateVehicleData(time);
-      testDataGenerator.UpdateTireData(time);
-      testDataGenerator.UpdateRelativeTimingData(time);
-
-      // Publish input telemetry data at 60Hz (throttled)
-      if (sampleTimer >= 1.0f / 60.0f)
-      {
-        inputTelemetryBroker.Publish(testDataGenerator.GetInputTelemetryData());
-        sampleTimer = 0.0f;
-      }
+    // Pick up the newest telemetry snapshots, lock-free, once per frame
+    leaderboardBroker.Dispatch();
+    relativeTimingBroker.Dispatch();
+    tireInfoBroker.Dispatch();
+    vehicleBroker.Dispatch();
+    inputTelemetryBroker.Dispatch();
+    lapDeltaBroker.Dispatch();
 
-      // Publish updated data to brokers
-      leaderboardBroker.Publish(testDataGenerator.GetLeaderboardData());
-      relativeTimingBroker.Publish(testDataGenerator.GetRelativeTimingData());
-      tireInfoBroker.Publish(testDataGenerator.GetTireData());
-      vehicleBroker.Publish(testDataGenerator.GetVehicleData());
+    // Let overlays pull the snapshots they need; unchanged data costs a version compare
+    for (auto* overlay : overlays)
+    {
+      overlay->Update(deltaTime);
     }
 
     // Render
+    TextCache::Instance().BeginFrame();
     BeginDrawing();
     ClearBackground(BLANK);
 
@@ -298,6 +470,41 @@ int main()
     EndDrawing();
   }
 
+  sourceManager.Stop();
+  const IngestExecutor::Stats& ingestStats = sourceManager.GetExecutorStats();
+  TraceLog(LOG_INFO, "SOURCE: %s, throttled polls: %llu, resumes: %llu, waits: %llu",
+    sourceManager.GetLastStatus().c_str(),
+    static_cast<unsigned long long>(sourceManager.GetThrottledPolls()),
+    static_cast<unsigned long long>(ingestStats.resumes),
+    static_cast<unsigned long long>(ingestStats.waits));
+
+  if (recorder.IsRecording())
+  {
+    recorder.Stop();
+    LogRecorderStats(recorder.GetStats());
+  }
+
+  LogBrokerStats("Leaderboard", leaderboardBroker.GetStats(), brokerTiming);
+  LogBrokerStats("RelativeTiming", relativeTimingBroker.GetStats(), brokerTiming);
+  LogBrokerStats("TireInfo", tireInfoBroker.GetStats(), brokerTiming);
+  LogBrokerStats("Vehicle", vehicleBroker.GetStats(), brokerTiming);
+  LogBrokerStats("InputTelemetry", inputTelemetryBroker.GetStats(), brokerTiming);
+  LogBrokerStats("LapDelta", lapDeltaBroker.GetStats(), brokerTiming);
+
+  const TextCache& textCache = TextCache::Instance();
+  const uint64_t textLookups = textCache.GetTotalLookups();
+  TraceLog(LOG_INFO, "TEXT: lookups: %llu, hits: %llu (%.1f%%), labels cached: %zu",
+    static_cast<unsigned long long>(textLookups),
+    static_cast<unsigned long long>(textCache.GetTotalHits()),
+    textLookups > 0 ? 100.0 * static_cast<double>(textCache.GetTotalHits()) / static_cast<double>(textLookups) : 100.0,
+    textCache.Size());
+
+  // Cached overlay textures and vertex buffers belong to the window's graphics context, the overlays outlive it
+  for (auto* overlay : overlays)
+  {
+    overlay->ReleaseGraphicsResources();
+  }
+
   UnloadFont(gFont);
   UnloadFont(gRegularFont);
   CloseWindow();
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Data/DataBroker.hpp>
+#include <Data/DataStructs.h>
+#include <DataReader/IngestExecutor.h>
+
+#include <chrono>
+#include <string>
+
+namespace pacemaker
+{
+
+/**
+ * @brief The brokers a telemetry source publishes to. The source's thread is their one producer thread.
+ */
+struct TelemetrySinks
+{
+	DataBroker<LeaderboardData>& leaderboard;
+	DataBroker<RelativeTimingData>& relativeTiming;
+	DataBroker<TireInfoData>& tireInfo;
+	DataBroker<VehicleData>& vehicle;
+	DataBroker<InputTelemetryData>& inputTelemetry;
+
+	/**
+	 * @brief Checks if the render thread is falling behind on the queued topics; sources that can wait should.
+	 */
+	[[nodiscard]] bool IsSaturated() const noexcept { return inputTelemetry.IsSaturated(); }
+};
+
+/**
+ * @brief How a telemetry source produces data.
+ */
+enum class SourceMode
+{
+	Polling, // The source computes data when asked: Poll() is called at the source's poll interval
+	Async,   // The source waits for data arriving from outside: Ingest() suspends until it is there
+};
+
+/**
+ * @brief Interface for producers of telemetry: the test data generator, a network feed, a sim's shared memory or a
+ *        recording. TelemetrySourceManager runs the sources it is given together on one ingestion thread.
+ */
+class ITelemetrySource
+{
+public:
+	/**
+	 * @brief Virtual destructor for ITelemetrySource.
+	 */
+	virtual ~ITelemetrySource() = default;
+
+	/**
+	 * @brief Gets a short name of the source for logging, e.g. "udp".
+	 */
+	[[nodiscard]] virtual const char* GetName() const = 0;
+
+	[[nodiscard]] virtual SourceMode GetMode() const = 0;
+
+	/**
+	 * @brief Attaches the source to the brokers and acquires its resources (sockets, files). Called before the ingestion
+	 *        thread starts.
+	 * @return false if the source cannot run, e.g. its port is taken.
+	 */
+	virtual bool Open(TelemetrySinks& sinks) = 0;
+
+	/**
+	 * @brief Polling sources: produces and publishes data for the time elapsed since the previous call.
+	 *        Time the manager held the source back because the sinks were saturated is not included.
+	 */
+	virtual void Poll(std::chrono::steady_clock::duration elapsed) { (void)elapsed; }
+
+	/**
+	 * @brief Polling sources: gets the interval between two Poll() calls.
+	 */
+	[[nodiscard]] virtual std::chrono::microseconds GetPollInterval() const { return std::chrono::microseconds(2000); }
+
+	/**
+	 * @brief Async sources: creates the pipeline receiving and publishing data on the executor's thread. It runs until
+	 *        the manager stops the executor.
+	 */
+	[[nodiscard]] virtual IngestTask Ingest(IngestExecutor& executor) { (void)executor; return {}; }
+
+	/**
+	 * @brief Releases the resources acquired by Open(). Called after the ingestion thread finished.
+	 */
+	virtual void Close() = 0;
+
+	/**
+	 * @brief Gets the source's counters as a line of text for logging.
+	 */
+	[[nodiscard]] virtual std::string GetStatus() const = 0;
+};
+
+} // namespace pacemaker
@@ -7,6 +7,10 @@
 #include <Utils/Geometry.h>
 
 #include <string>
+#include <memory>
+
+// Forward declarations for Raylib
+struct RenderTexture;
 
 namespace pacemaker
 {
@@ -27,9 +31,9 @@ public:
   BaseWidget(std::string_view name, Bounds bounds, MinSize minSize);
 
   /**
-   * @brief Default virtual destructor for BaseWidget.
+   * @brief Virtual destructor for BaseWidget, releases the render cache if it is still held.
    */
-  virtual ~BaseWidget() = default;
+  virtual ~BaseWidget();
 
   // IDraggable implementation
 
@@ -88,6 +92,20 @@ public:
    */
   void SetVisible(bool visible) noexcept override { m_isVisible = visible; }
 
+  /**
+   * @brief IRenderable implementation, draws the widget with RenderContent() if it is visible.
+   *        With the render cache enabled, RenderContent() draws into the widget's own render texture only when the
+   *        cache was invalidated or the widget was resized; every other frame composites that texture in one quad.
+   */
+  void Render() const override;
+
+  /**
+   * @brief Frees the GPU objects the widget holds, such as the render cache's texture; the next Render() recreates
+   *        them. Call before the window is closed, as they belong to the graphics context. Widgets creating GPU
+   *        objects of their own override it and call the base.
+   */
+  virtual void ReleaseGraphicsResources();
+
   /**
    * @copydoc IRenderable::RenderBorder
    */
@@ -109,6 +127,30 @@ public:
   void Update(float deltaTime) override {}
 
 
+protected:
+  /**
+   * @brief Draws the widget at m_bounds. Called by Render(), only if the widget is visible.
+   */
+  virtual void RenderContent() const = 0;
+
+  /**
+   * @brief Gets the area RenderContent() draws in, which the render cache covers. Widgets drawing past their bounds
+   *        override it.
+   */
+  [[nodiscard]] virtual Bounds GetContentBounds() const { return m_bounds; }
+
+  /**
+   * @brief Makes Render() draw through a cached render texture. Suits widgets whose content changes a few times a
+   *        second at most; they must call InvalidateRenderCache() whenever what they draw changes.
+   */
+  void EnableRenderCache() noexcept { m_isCacheEnabled = true; }
+
+  /**
+   * @brief Marks the cached content as stale, e.g. when a new data version or a style change alters what is drawn.
+   *        Moving the widget does not need it, resizing invalidates the cache by itself.
+   */
+  void InvalidateRenderCache() noexcept { m_isCacheValid = false; }
+
 protected:
   Bounds m_bounds{};          // Position and size of the widget
   MinSize m_minSize{};        // Minimum size constraints
@@ -118,5 +160,19 @@ protected:
   int m_dragOffsetX{ 0 };     // X Offset from mouse position to widget origin when dragging
   int m_dragOffsetY{ 0 };     // Y Offset from mouse position to widget origin when dragging
   std::string m_name{};       // Name of the widget
+
+private:
+  struct RenderTextureDeleter
+  {
+    void operator()(RenderTexture* texture) const;
+  };
+
+  bool RedrawRenderCache() const;
+
+  bool m_isCacheEnabled{ false };       // Render() draws through the cache
+  mutable bool m_isCacheValid{ false }; // The cache holds the current content
+  mutable int m_cachedWidth{ 0 };       // Widget width the cache was drawn at
+  mutable int m_cachedHeight{ 0 };      // Widget height the cache was drawn at
+  mutable std::unique_ptr<RenderTexture, RenderTextureDeleter> m_renderCache; // Content bounds drawn at the origin
 };
 }
\ No newline at end of file
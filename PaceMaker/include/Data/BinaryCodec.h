@@ -0,0 +1,243 @@
+#pragma once
+
+#include <Data/Schema.h>
+
+#include <bit>
+#include <span>
+#include <vector>
+#include <cstring>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace pacemaker
+{
+  /**
+   * @brief Packed little-endian binary codec for schema structs.
+   *
+   * Wire format, in schema order and without padding:
+   *   value   sizeof(type) bytes, little-endian; bool is one byte
+   *   array   count elements back to back
+   *   list    uint32 element count, then the elements
+   *   struct  its fields
+   * On little-endian hosts every scalar is a plain memcpy; big-endian hosts swap bytes.
+   * The format carries no schema id or version; framing is up to recording, replay and IPC.
+   */
+  class BinaryCodec
+  {
+  public:
+    /**
+     * @brief Appends the encoding of a value to a buffer. Reuses the buffer's capacity, so encoding
+     *        into the same buffer every tick does not allocate once it has grown.
+     * @param value The value to encode.
+     * @param buffer Destination, appended to.
+     */
+    template<typename T>
+      requires SchemaStruct<T>
+    static void Encode(const T& value, std::vector<std::byte>& buffer)
+    {
+      const size_t offset = buffer.size();
+      buffer.resize(offset + EncodedSize(value));
+      std::byte* cursor = buffer.data() + offset;
+      Write(cursor, value);
+    }
+
+    /**
+     * @brief Decodes a value from the front of a byte range.
+     * @param bytes Encoded data, possibly followed by more.
+     * @param value Destination; list members reuse their capacity.
+     * @return Number of bytes consumed, or 0 if the data is truncated or malformed.
+     */
+    template<typename T>
+      requires SchemaStruct<T>
+    [[nodiscard]] static size_t Decode(std::span<const std::byte> bytes, T& value)
+    {
+      Reader reader{ bytes.data(), bytes.data() + bytes.size() };
+      if (!Read(reader, value))
+      {
+        return 0;
+      }
+      return static_cast<size_t>(reader.cursor - bytes.data());
+    }
+
+    /**
+     * @brief Computes the number of bytes Encode() appends for a value.
+     */
+    template<typename T>
+    [[nodiscard]] static size_t EncodedSize(const T& value) noexcept
+    {
+      if constexpr (SchemaStruct<T>)
+      {
+        size_t size = 0;
+        ForEachField(value, [&size](const char*, const auto& member) { size += EncodedSize(member); });
+        return size;
+      }
+      else if constexpr (std::is_array_v<T>)
+      {
+        return std::extent_v<T> * EncodedSize(value[0]);
+      }
+      else if constexpr (IsVector<T>::value)
+      {
+        size_t size = sizeof(uint32_t);
+        for (const auto& element : value)
+        {
+          size += EncodedSize(element);
+        }
+        return size;
+      }
+      else
+      {
+        return WireSize<T>();
+      }
+    }
+
+  private:
+    struct Reader
+    {
+      const std::byte* cursor;
+      const std::byte* end;
+    };
+
+    template<typename T>
+    struct IsVector : std::false_type {};
+
+    template<typename T, typename Allocator>
+    struct IsVector<std::vector<T, Allocator>> : std::true_type {};
+
+    template<typename T>
+    static constexpr size_t WireSize() noexcept
+    {
+      static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Schema fields must be scalars, arrays, lists or schema structs");
+      return std::is_same_v<T, bool> ? 1 : sizeof(T);
+    }
+
+    template<typename T>
+    static void Write(std::byte*& cursor, const T& value)
+    {
+      if constexpr (SchemaStruct<T>)
+      {
+        ForEachField(value, [&cursor](const char*, const auto& member) { Write(cursor, member); });
+      }
+      else if constexpr (std::is_array_v<T>)
+      {
+        for (const auto& element : value)
+        {
+          Write(cursor, element);
+        }
+      }
+      else if constexpr (IsVector<T>::value)
+      {
+        WriteScalar(cursor, static_cast<uint32_t>(value.size()));
+        for (const auto& element : value)
+        {
+          Write(cursor, element);
+        }
+      }
+      else
+      {
+        WriteScalar(cursor, value);
+      }
+    }
+
+    template<typename T>
+    [[nodiscard]] static bool Read(Reader& reader, T& value)
+    {
+      if constexpr (SchemaStruct<T>)
+      {
+        bool ok = true;
+        ForEachField(value, [&reader, &ok](const char*, auto& member) { ok = ok && Read(reader, member); });
+        return ok;
+      }
+      else if constexpr (std::is_array_v<T>)
+      {
+        for (auto& element : value)
+        {
+          if (!Read(reader, element))
+          {
+            return false;
+          }
+        }
+        return true;
+      }
+      else if constexpr (IsVector<T>::value)
+      {
+        uint32_t count = 0;
+        // Every element takes at least one byte, which bounds the count before anything is allocated
+        if (!ReadScalar(reader, count) || count > static_cast<size_t>(reader.end - reader.cursor))
+        {
+          return false;
+        }
+        value.resize(count);
+        for (auto& element : value)
+        {
+          if (!Read(reader, element))
+          {
+            return false;
+          }
+        }
+        return true;
+      }
+      else
+      {
+        return ReadScalar(reader, value);
+      }
+    }
+
+    template<typename T>
+    static void WriteScalar(std::byte*& cursor, T value) noexcept
+    {
+      if constexpr (std::is_same_v<T, bool>)
+      {
+        *cursor++ = static_cast<std::byte>(value ? 1 : 0);
+      }
+      else
+      {
+        if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1)
+        {
+          value = ByteSwap(value);
+        }
+        std::memcpy(cursor, &value, sizeof(T));
+        cursor += sizeof(T);
+      }
+    }
+
+    template<typename T>
+    [[nodiscard]] static bool ReadScalar(Reader& reader, T& value) noexcept
+    {
+      constexpr size_t size = WireSize<T>();
+      if (static_cast<size_t>(reader.end - reader.cursor) < size)
+      {
+        return false;
+      }
+
+      if constexpr (std::is_same_v<T, bool>)
+      {
+        value = *reader.cursor != std::byte{ 0 };
+      }
+      else
+      {
+        std::memcpy(&value, reader.cursor, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1)
+        {
+          value = ByteSwap(value);
+        }
+      }
+      reader.cursor += size;
+      return true;
+    }
+
+    template<typename T>
+    [[nodiscard]] static T ByteSwap(T value) noexcept
+    {
+      std::byte bytes[sizeof(T)];
+      std::memcpy(bytes, &value, sizeof(T));
+      for (size_t i = 0; i < sizeof(T) / 2; ++i)
+      {
+        std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+      }
+      std::memcpy(&value, bytes, sizeof(T));
+      return value;
+    }
+  };
+} // namespace pacemaker
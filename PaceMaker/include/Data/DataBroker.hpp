@@ -1,12 +1,64 @@
 #pragma once
 
-#include <functional>
-#include <unordered_map>
+#include <Data/TripleBuffer.hpp>
+#include <Data/SpscQueue.hpp>
+#include <Utils/Delegate.hpp>
+
+#include <vector>
+#include <array>
+#include <algorithm>
 #include <concepts>
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <atomic>
+#include <chrono>
 
 namespace pacemaker
 {
 
+/**
+* @brief Selects how DataBroker hands published data over to its subscribers.
+*/
+enum class BrokerMode
+{
+  Immediate,  // Publish() runs every subscriber callback synchronously on the publishing thread
+  Concurrent, // Publish() may be called from one telemetry thread; Dispatch() delivers the newest value on the consumer thread
+  ConcurrentQueued, // Like Concurrent, but every published value is queued and Dispatch() delivers all of them in order
+};
+
+/**
+* @brief Selects what a rate-limited subscription does with values that arrive before it is due again.
+*/
+enum class CoalescePolicy
+{
+  LatestWins, // Hold back and deliver only the newest value once the subscription is due
+  KeepAll,    // Queue values in a bounded backlog and deliver the whole backlog, in order, once due
+  Decimate,   // Drop values that arrive early; deliver the first value published after the subscription is due
+};
+
+/**
+* @brief Delivery options of a single subscription.
+*/
+struct SubscriptionOptions
+{
+  double maxRateHz{ 0.0 }; // Maximum deliveries per second, 0 delivers every value as soon as it is published
+  CoalescePolicy policy{ CoalescePolicy::LatestWins }; // Handling of values arriving faster than maxRateHz
+  size_t queueCapacity{ 256 }; // Backlog size for KeepAll; the oldest value is dropped when full
+};
+
+/**
+* @brief Per-topic counters collected by DataBroker.
+*/
+struct BrokerStats
+{
+  uint64_t published{ 0 };  // Values handed to Publish()
+  uint64_t suppressed{ 0 }; // Values dropped because they equal the latest snapshot (deduplication)
+  uint64_t fanOuts{ 0 };    // Values delivered to subscribers; in Concurrent mode at most one per Dispatch()
+  uint64_t dropped{ 0 };    // Values lost because a ConcurrentQueued transport or a KeepAll backlog was full
+  std::chrono::nanoseconds fanOutTime{ 0 }; // Total time spent running subscriber callbacks, 0 unless SetFanOutTiming()
+};
+
 /**
 * DataBroker class template for managing data subscriptions and notifications.
 * Uses observer pattern for real-time data streaming
@@ -16,31 +68,118 @@ class DataBroker
 {
 public:
   using SubscriptionId = size_t;
-  using DataReceivedCallback = std::function<void(const T&)>;
+  using DataReceivedCallback = Delegate<void(const T&)>;
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Constructs a DataBroker
+   * @param mode Immediate for single-threaded use, Concurrent or ConcurrentQueued to let one producer thread publish
+   *             while the consumer thread (usually the render loop) picks data up via Dispatch()
+   * @param queueCapacity Number of values the ConcurrentQueued transport holds between two Dispatch() calls
+   */
+  explicit DataBroker(BrokerMode mode = BrokerMode::Immediate, size_t queueCapacity = 1024)
+    : m_mode(mode)
+  {
+    m_snapshot = AcquireSnapshotSlot();
+
+    if (m_mode == BrokerMode::Concurrent)
+    {
+      m_exchange = std::make_unique<TripleBuffer<T>>();
+    }
+    else if (m_mode == BrokerMode::ConcurrentQueued)
+    {
+      m_queue = std::make_unique<SpscQueue<T>>(queueCapacity);
+    }
+  }
+
+  DataBroker(const DataBroker&) = delete;
+  DataBroker& operator=(const DataBroker&) = delete;
 
   /**
    * @brief Subscribe to data updates
-   * @param callback Function to call when new data is published
+   *        In Concurrent mode call this from the consumer thread only.
+   *        Safe to call from inside a callback; the new subscriber then starts receiving from the next publish.
+   *        E.g. a 1 kHz input stream feeding a graph at 144 Hz while keeping every sample:
+   *        broker.Subscribe(callback, { .maxRateHz = 144.0, .policy = CoalescePolicy::KeepAll });
+   * @param callback Function to call when new data is published, stored inline without allocating
+   * @param options Maximum delivery rate and coalescing policy; the default delivers every value immediately
    * @return SubscriptionId Unique ID for the subscription, used for unsubscribing
    */
-  [[nodiscard]] SubscriptionId Subscribe(DataReceivedCallback callback) {
+  [[nodiscard]] SubscriptionId Subscribe(DataReceivedCallback callback, const SubscriptionOptions& options = {}) {
     auto id = m_nextId++;
-    m_subscribers[id] = std::move(callback);
+    Subscriber subscriber = MakeSubscriber(id, std::move(callback), options);
 
-    // Immediately send latest data to new subscriber
+    // Growing the table while it is being walked would move the callback that is currently running
+    if (m_dispatchDepth > 0)
+    {
+      m_pendingSubscribers.push_back(std::move(subscriber));
+      m_hasPendingChanges = true;
+      return id;
+    }
+
+    m_subscribers.push_back(std::move(subscriber));
+
+    // Immediately send latest data to new subscriber. The callback counts as a dispatch, so the table stays put if it
+    // subscribes, unsubscribes or publishes; the snapshot is held in case a publish replaces it.
     if (m_subscribers.size() > 1)
     {
-      callback(m_latestData);
+      auto& added = m_subscribers.back();
+      added.nextDue = Clock::now() + added.period;
+      const std::shared_ptr<T> snapshot = m_snapshot;
+
+      ++m_dispatchDepth;
+      added.callback(*snapshot);
+      if (--m_dispatchDepth == 0 && m_hasPendingChanges)
+      {
+        ApplyPendingChanges();
+      }
     }
 
     return id;
   }
 
   /** @brief Unsubscribe from data updates
+   *         Safe to call from inside a callback, including for the subscription currently being notified.
    *  @param id Subscription ID to unsubscribe
    */
   void Unsubscribe(SubscriptionId id) {
-    m_subscribers.erase(id);
+    const auto pendingRemoved = std::erase_if(m_pendingSubscribers, [this, id](const Subscriber& subscriber) {
+      if (subscriber.id != id)
+      {
+        return false;
+      }
+      if (subscriber.period != Clock::duration::zero())
+      {
+        --m_rateLimitedCount;
+      }
+      return true;
+    });
+    if (pendingRemoved > 0)
+    {
+      return;
+    }
+
+    // Ids are handed out in increasing order and the table is append-only, so it stays sorted by id
+    auto it = std::lower_bound(m_subscribers.begin(), m_subscribers.end(), id,
+      [](const Subscriber& subscriber, SubscriptionId value) { return subscriber.id < value; });
+    if (it == m_subscribers.end() || it->id != id)
+    {
+      return;
+    }
+
+    if (m_dispatchDepth > 0)
+    {
+      it->active = false; // Tombstone, compacted once the outermost dispatch returns
+      m_hasPendingChanges = true;
+    }
+    else
+    {
+      if (it->period != Clock::duration::zero())
+      {
+        --m_rateLimitedCount;
+      }
+      m_subscribers.erase(it);
+    }
   }
 
   /**
@@ -48,15 +187,37 @@ public:
    *        E.g.:
    *        LeaderboardData data = testDataGenerator.GetLeaderboardData();
    *        leaderboardBroker.Publish(data);  // Copy version - 'data' is still valid
+   *        In Concurrent mode the data is only staged; subscribers see it on the next Dispatch().
    * @param data The data to publish
    */
   void Publish(const T& data) {
-    m_latestData = data;
+    CountPublish();
+    if (m_producerHook)
+    {
+      m_producerHook(data);
+    }
+
+    if (m_producerState)
+    {
+      *m_producerState = data;
+      StageForConsumer(*m_producerState);
+      return;
+    }
+
+    if (m_exchange || m_queue)
+    {
+      StageForConsumer(data);
+      return;
+    }
 
-    for (const auto& [id, callback] : m_subscribers)
+    if (IsDuplicate(data))
     {
-      callback(data);
+      return;
     }
+
+    auto snapshot = AcquireSnapshotSlot();
+    *snapshot = data;
+    CommitSnapshot(std::move(snapshot));
   }
 
   /**
@@ -69,29 +230,579 @@ public:
    * @param data The data to publish
    */
   void Publish(T&& data) {
-    m_latestData = std::move(data);
+    CountPublish();
+    if (m_producerHook)
+    {
+      m_producerHook(data);
+    }
 
-    for (const auto& [id, callback] : m_subscribers)
+    if (m_producerState)
     {
-      callback(m_latestData);
+      *m_producerState = std::move(data);
+      StageForConsumer(*m_producerState);
+      return;
     }
+
+    if (m_exchange || m_queue)
+    {
+      StageForConsumer(std::move(data));
+      return;
+    }
+
+    if (IsDuplicate(data))
+    {
+      return;
+    }
+
+    auto snapshot = AcquireSnapshotSlot();
+    *snapshot = std::move(data);
+    CommitSnapshot(std::move(snapshot));
+  }
+
+  /**
+   * @brief Publish only what changed since the previous publish. The delta is applied to a copy of the latest value
+   *        with a free function `bool ApplyDelta(T&, const Delta&, uint64_t revision)` found by argument-dependent
+   *        lookup, which stamps what it changed with the revision and returns false if nothing changed.
+   *        Deltas that change nothing are not published at all.
+   *        In Concurrent and ConcurrentQueued modes call SetDeltaPublishing(true) before the producer starts.
+   *        E.g.:
+   *        leaderboardBroker.PublishDelta(testDataGenerator.GetLeaderboardDelta());
+   * @param delta The changes to apply on top of the latest published value
+   */
+  template<typename Delta>
+    requires requires(T& data, const Delta& delta, uint64_t revision) { { ApplyDelta(data, delta, revision) } -> std::convertible_to<bool>; }
+  void PublishDelta(const Delta& delta) {
+    const uint64_t revision = m_deltaRevision + 1;
+
+    if (m_exchange || m_queue)
+    {
+      // The consumer owns the snapshots, so the producer keeps its own copy of the latest value to patch
+      if (!m_producerState || !ApplyDelta(*m_producerState, delta, revision))
+      {
+        return;
+      }
+
+      m_deltaRevision = revision;
+      CountPublish();
+      if (m_producerHook)
+      {
+        m_producerHook(*m_producerState);
+      }
+      StageForConsumer(*m_producerState);
+      return;
+    }
+
+    // Copy-assigning into a recycled slot reuses its buffers; the slot simply stays in the pool if nothing changed
+    auto snapshot = AcquireSnapshotSlot();
+    *snapshot = *m_snapshot;
+    if (!ApplyDelta(*snapshot, delta, revision))
+    {
+      return;
+    }
+
+    m_deltaRevision = revision;
+    CountPublish();
+    if (m_producerHook)
+    {
+      m_producerHook(*snapshot);
+    }
+    CommitSnapshot(std::move(snapshot));
+  }
+
+  /**
+   * @brief Deliver what the producer thread staged since the previous call, then flush rate-limited subscriptions
+   *        whose held-back values became due. Call once per frame from the consumer thread, in every mode; it never
+   *        blocks. Concurrent mode delivers the newest value only, ConcurrentQueued delivers every queued value in order.
+   * @return true if subscribers were notified with at least one newer value
+   */
+  bool Dispatch() {
+    bool delivered = false;
+
+    if (m_exchange && m_exchange->Fetch())
+    {
+      delivered = CommitStaged(m_exchange->ReadBuffer());
+    }
+    else if (m_queue)
+    {
+      while (T* staged = m_queue->Front())
+      {
+        delivered |= CommitStaged(*staged);
+        m_queue->Pop();
+      }
+    }
+
+    if (m_rateLimitedCount > 0)
+    {
+      FlushDueSubscribers(Clock::now());
+    }
+
+    return delivered;
   }
 
   /**
    * @brief Access the latest published data
+   *        In Concurrent mode this is the latest dispatched data and must be read on the consumer thread.
    * @return const T& Reference to the latest published data
    */
-  [[nodiscard]] const T& GetLatest() const noexcept { return m_latestData; }
+  [[nodiscard]] const T& GetLatest() const noexcept { return *m_snapshot; }
+
+  /**
+   * @brief Access the latest published data as a shared immutable snapshot
+   *        The snapshot stays valid and unchanged for as long as the caller holds it, later publishes never touch it.
+   *        Call on the consumer thread in Concurrent mode.
+   * @return std::shared_ptr<const T> The latest snapshot, never null
+   */
+  [[nodiscard]] std::shared_ptr<const T> GetSnapshot() const noexcept { return m_snapshot; }
+
+  /**
+   * @brief Pull the latest snapshot if it is newer than the version the caller has already seen
+   *        E.g.:
+   *        if (auto snapshot = broker.TryGetSnapshot(m_version)) { m_data = std::move(snapshot); }
+   * @param lastSeenVersion Version the caller holds, updated to the current version when a snapshot is returned.
+   *                        Start from 0, which is the version of the default-constructed data before any publish.
+   * @return std::shared_ptr<const T> The latest snapshot, or nullptr if nothing was published since lastSeenVersion
+   */
+  [[nodiscard]] std::shared_ptr<const T> TryGetSnapshot(uint64_t& lastSeenVersion) const noexcept {
+    if (lastSeenVersion == m_version)
+    {
+      return nullptr;
+    }
+
+    lastSeenVersion = m_version;
+    return m_snapshot;
+  }
+
+  /**
+   * @brief Access the version of the latest snapshot, incremented by one on every publish
+   * @return uint64_t Monotonically increasing version, 0 before the first publish
+   */
+  [[nodiscard]] uint64_t GetVersion() const noexcept { return m_version; }
+
+  /**
+   * @brief Checks if the consumer is falling behind: the ConcurrentQueued transport is more than three quarters full.
+   *        Producers that can slow down, e.g. a replay, should hold off until it drains instead of having values
+   *        dropped. Always false in the other modes, where a newer value simply replaces an older one.
+   *        Call from the producer thread.
+   */
+  [[nodiscard]] bool IsSaturated() const noexcept {
+    return m_queue && m_queue->SizeApprox() * 4 > m_queue->Capacity() * 3;
+  }
 
   /**
    * @brief Access the number of current subscribers
    * @return size_t Number of subscribers
    */
-  [[nodiscard]] size_t SubscriberCount() const noexcept { return m_subscribers.size(); }
+  [[nodiscard]] size_t SubscriberCount() const noexcept {
+    auto active = std::count_if(m_subscribers.begin(), m_subscribers.end(),
+      [](const Subscriber& subscriber) { return subscriber.active; });
+    return static_cast<size_t>(active) + m_pendingSubscribers.size();
+  }
+
+  /**
+   * @brief Enable or disable publish-on-change: a value equal to the latest snapshot is counted and dropped
+   *        without bumping the version or notifying anyone. Off by default.
+   * @param enabled true to suppress duplicates
+   */
+  void SetDeduplication(bool enabled) noexcept requires std::equality_comparable<T> { m_deduplicate = enabled; }
+
+  /**
+   * @brief Checks if publish-on-change deduplication is enabled
+   */
+  [[nodiscard]] bool IsDeduplicating() const noexcept { return m_deduplicate; }
+
+  /**
+   * @brief Enable or disable timing the subscriber callbacks into BrokerStats::fanOutTime. Off by default: reading the
+   *        clock twice per publish costs more than a fan-out to a few subscribers.
+   * @param enabled true to time fan-outs
+   */
+  void SetFanOutTiming(bool enabled) noexcept { m_timeFanOut = enabled; }
+
+  /**
+   * @brief Checks if fan-outs are timed
+   */
+  [[nodiscard]] bool IsTimingFanOut() const noexcept { return m_timeFanOut; }
+
+  /**
+   * @brief Enable or disable PublishDelta() in Concurrent and ConcurrentQueued modes, where the producer thread then keeps
+   *        a private copy of the latest published value to apply deltas to. Costs one extra copy per whole Publish().
+   *        Call before the producer thread starts publishing; Immediate mode needs no opt-in.
+   * @param enabled true to accept deltas
+   */
+  void SetDeltaPublishing(bool enabled) {
+    if (m_mode == BrokerMode::Immediate)
+    {
+      return;
+    }
+
+    if (!enabled)
+    {
+      m_producerState.reset();
+    }
+    else if (!m_producerState)
+    {
+      m_producerState = std::make_unique<T>(*m_snapshot);
+    }
+  }
+
+  /**
+   * @brief Sets a callback run on the publishing thread with every value published, before it is handed on. Lets a
+   *        topic derived from this one be computed and published where the data arrives, rather than on the consumer
+   *        thread a frame later. Set before the producer starts; an empty delegate removes it.
+   *        E.g.:
+   *        vehicleBroker.SetProducerHook([&](const VehicleData& vehicle) { lapDeltaBroker.Publish(Derive(vehicle)); });
+   */
+  void SetProducerHook(Delegate<void(const T&)> hook) {
+    m_producerHook = std::move(hook);
+  }
+
+  /**
+   * @brief Access the counters collected for this topic
+   *        In Concurrent mode call this from the consumer thread.
+   * @return BrokerStats Copy of the current counters
+   */
+  [[nodiscard]] BrokerStats GetStats() const noexcept {
+    BrokerStats stats = m_stats;
+    stats.published = m_publishCount.load(std::memory_order_relaxed);
+    stats.dropped += m_queueDropCount.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  /**
+   * @brief Access the mode the broker was created with
+   * @return BrokerMode Immediate, Concurrent or ConcurrentQueued
+   */
+  [[nodiscard]] BrokerMode GetMode() const noexcept { return m_mode; }
 
 private:
-  std::unordered_map<SubscriptionId, DataReceivedCallback> m_subscribers; // Map of subscription ID to callback
+  /**
+   * @brief Entry of the contiguous subscriber table
+   */
+  struct Subscriber
+  {
+    SubscriptionId id;
+    bool active;
+    bool hasPending; // LatestWins: a value was held back and the latest snapshot is owed
+    CoalescePolicy policy;
+    DataReceivedCallback callback;
+    Clock::duration period; // Minimum time between deliveries, zero when not rate limited
+    Clock::time_point nextDue; // Earliest time of the next delivery
+    std::vector<T> backlog; // KeepAll ring storage, sized once on subscribe
+    size_t backlogHead; // Index of the oldest queued value
+    size_t backlogSize; // Number of queued values
+  };
+
+  /**
+   * @brief Build a subscriber table entry from the subscription options
+   */
+  Subscriber MakeSubscriber(SubscriptionId id, DataReceivedCallback callback, const SubscriptionOptions& options) {
+    Subscriber subscriber{ id, true, false, options.policy, std::move(callback), Clock::duration::zero(), {}, {}, 0, 0 };
+
+    if (options.maxRateHz > 0.0)
+    {
+      subscriber.period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options.maxRateHz));
+      ++m_rateLimitedCount;
+
+      if (options.policy == CoalescePolicy::KeepAll)
+      {
+        subscriber.backlog.resize(std::max<size_t>(options.queueCapacity, 1));
+      }
+    }
+
+    return subscriber;
+  }
+
+  /**
+   * @brief Invoke every active subscriber in subscription order, then apply changes requested from within callbacks
+   * @param data The data to deliver
+   */
+  void NotifySubscribers(const T& data) {
+    ++m_dispatchDepth;
+
+    const auto now = m_rateLimitedCount > 0 ? Clock::now() : Clock::time_point{};
+
+    // The table cannot reallocate or shrink while dispatching: subscriptions made from callbacks go to
+    // m_pendingSubscribers and removals only set tombstones, so the range stays valid for the whole walk
+    Subscriber* subscriber = m_subscribers.data();
+    Subscriber* const end = subscriber + m_subscribers.size();
+    for (; subscriber != end; ++subscriber)
+    {
+      if (!subscriber->active)
+      {
+        continue;
+      }
+
+      if (subscriber->period == Clock::duration::zero())
+      {
+        subscriber->callback(data);
+      }
+      else
+      {
+        DeliverRateLimited(*subscriber, data, now);
+      }
+    }
+
+    if (--m_dispatchDepth == 0 && m_hasPendingChanges)
+    {
+      ApplyPendingChanges();
+    }
+  }
+
+  /**
+   * @brief Deliver a value to a rate-limited subscriber, or coalesce it according to its policy if it is not due yet
+   */
+  void DeliverRateLimited(Subscriber& subscriber, const T& data, Clock::time_point now) {
+    if (now < subscriber.nextDue)
+    {
+      switch (subscriber.policy)
+      {
+      case CoalescePolicy::LatestWins:
+        subscriber.hasPending = true;
+        break;
+      case CoalescePolicy::KeepAll:
+        EnqueueBacklog(subscriber, data);
+        break;
+      case CoalescePolicy::Decimate:
+        break;
+      }
+      return;
+    }
+
+    AdvanceDue(subscriber, now);
+    subscriber.hasPending = false;
+    DrainBacklog(subscriber);
+
+    if (subscriber.active)
+    {
+      subscriber.callback(data);
+    }
+  }
+
+  /**
+   * @brief Deliver held-back values of rate-limited subscribers that became due without a new publish
+   */
+  void FlushDueSubscribers(Clock::time_point now) {
+    ++m_dispatchDepth;
+
+    // Hold the latest snapshot: a callback may publish again and replace m_snapshot meanwhile
+    const std::shared_ptr<const T> latest = m_snapshot;
+
+    Subscriber* subscriber = m_subscribers.data();
+    Subscriber* const end = subscriber + m_subscribers.size();
+    for (; subscriber != end; ++subscriber)
+    {
+      if (!subscriber->active || now < subscriber->nextDue || (!subscriber->hasPending && subscriber->backlogSize == 0))
+      {
+        continue;
+      }
+
+      AdvanceDue(*subscriber, now);
+      DrainBacklog(*subscriber);
+
+      if (subscriber->hasPending && subscriber->active)
+      {
+        subscriber->hasPending = false;
+        subscriber->callback(*latest);
+      }
+    }
+
+    if (--m_dispatchDepth == 0 && m_hasPendingChanges)
+    {
+      ApplyPendingChanges();
+    }
+  }
+
+  /**
+   * @brief Schedule the next delivery one period later, keeping a steady cadence unless the subscriber fell behind
+   */
+  static void AdvanceDue(Subscriber& subscriber, Clock::time_point now) {
+    subscriber.nextDue = (now - subscriber.nextDue < subscriber.period)
+      ? subscriber.nextDue + subscriber.period
+      : now + subscriber.period;
+  }
+
+  /**
+   * @brief Append a copy to a KeepAll backlog, overwriting the oldest value when it is full
+   */
+  void EnqueueBacklog(Subscriber& subscriber, const T& data) {
+    const size_t capacity = subscriber.backlog.size();
+    if (subscriber.backlogSize == capacity)
+    {
+      subscriber.backlogHead = (subscriber.backlogHead + 1) % capacity;
+      --subscriber.backlogSize;
+      ++m_stats.dropped;
+    }
+
+    subscriber.backlog[(subscriber.backlogHead + subscriber.backlogSize) % capacity] = data;
+    ++subscriber.backlogSize;
+  }
+
+  /**
+   * @brief Deliver a KeepAll backlog oldest first
+   *        The value is taken out of the ring before the call, so a callback publishing again cannot overwrite it.
+   */
+  static void DrainBacklog(Subscriber& subscriber) {
+    while (subscriber.backlogSize > 0 && subscriber.active)
+    {
+      T value = std::move(subscriber.backlog[subscriber.backlogHead]);
+      subscriber.backlogHead = (subscriber.backlogHead + 1) % subscriber.backlog.size();
+      --subscriber.backlogSize;
+      subscriber.callback(value);
+    }
+  }
+
+  /**
+   * @brief Hand a value to the consumer thread through the triple buffer or the queue. Producer thread only.
+   */
+  template<typename U>
+  void StageForConsumer(U&& data) {
+    if (m_exchange)
+    {
+      m_exchange->WriteBuffer() = std::forward<U>(data);
+      m_exchange->Commit();
+    }
+    else if (!m_queue->TryPush(std::forward<U>(data)))
+    {
+      m_queueDropCount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Turn a value staged by the producer thread into the latest snapshot and notify subscribers
+   * @param staged Transport slot owned by the consumer thread; receives the recycled snapshot's contents
+   * @return true if the value was delivered, false if it was suppressed as a duplicate
+   */
+  bool CommitStaged(T& staged) {
+    // Deduplication runs here rather than in Publish() to keep the producer thread free of comparisons
+    if (IsDuplicate(staged))
+    {
+      return false;
+    }
+
+    // Swapping rather than moving hands the recycled snapshot's buffers back to the producer,
+    // so its next write into this slot reuses their capacity
+    auto snapshot = AcquireSnapshotSlot();
+    using std::swap;
+    swap(*snapshot, staged);
+    CommitSnapshot(std::move(snapshot));
+    return true;
+  }
+
+  /**
+   * @brief Count a publish. Only the publishing thread writes the counter, so a plain load and store do without the
+   *        locked read-modify-write of fetch_add()
+   */
+  void CountPublish() noexcept {
+    m_publishCount.store(m_publishCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Find a pooled snapshot nobody references anymore, or create one while the pool has room
+   *        Consumers pick snapshots up at frame rate, so a handful of slots is enough for publishes to stop
+   *        allocating and to reuse the buffers (vectors, strings) of a snapshot that was already let go.
+   * @return std::shared_ptr<T> Writable snapshot, not yet visible to anyone
+   */
+  std::shared_ptr<T> AcquireSnapshotSlot() {
+    for (auto& slot : m_snapshotPool)
+    {
+      if (!slot)
+      {
+        slot = std::make_shared<T>();
+        return slot;
+      }
+      if (slot.use_count() == 1)
+      {
+        return slot;
+      }
+    }
+
+    // Every pooled snapshot is still held by a consumer; fall back to a one-off allocation
+    return std::make_shared<T>();
+  }
+
+  /**
+   * @brief Make a filled snapshot the latest one, bump the version and notify subscribers
+   * @param snapshot The snapshot to publish
+   */
+  void CommitSnapshot(std::shared_ptr<T> snapshot) {
+    m_snapshot = std::move(snapshot);
+    ++m_version;
+
+    // Keep the snapshot alive locally: a callback may publish again and replace m_snapshot meanwhile
+    const std::shared_ptr<const T> current = m_snapshot;
+    if (m_timeFanOut)
+    {
+      const auto fanOutStart = Clock::now();
+      NotifySubscribers(*current);
+      m_stats.fanOutTime += Clock::now() - fanOutStart;
+    }
+    else
+    {
+      NotifySubscribers(*current);
+    }
+    ++m_stats.fanOuts;
+  }
+
+  /**
+   * @brief Check a value against the latest snapshot when deduplication is enabled, counting suppressed values
+   * @param data The value about to be published
+   * @return true if the value must be dropped
+   */
+  bool IsDuplicate(const T& data) {
+    if constexpr (std::equality_comparable<T>)
+    {
+      // Version 0 is the default-constructed placeholder, the first real value always goes through
+      if (m_deduplicate && m_version > 0 && data == *m_snapshot)
+      {
+        ++m_stats.suppressed;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Drop tombstoned subscribers and append the ones subscribed during dispatch, preserving order
+   */
+  void ApplyPendingChanges() {
+    std::erase_if(m_subscribers, [this](const Subscriber& subscriber) {
+      if (subscriber.active)
+      {
+        return false;
+      }
+      if (subscriber.period != Clock::duration::zero())
+      {
+        --m_rateLimitedCount;
+      }
+      return true;
+    });
+
+    for (auto& subscriber : m_pendingSubscribers)
+    {
+      m_subscribers.push_back(std::move(subscriber));
+    }
+    m_pendingSubscribers.clear();
+    m_hasPendingChanges = false;
+  }
+
+  std::vector<Subscriber> m_subscribers; // Contiguous subscriber table, sorted by subscription ID
+  std::vector<Subscriber> m_pendingSubscribers; // Subscriptions made while a dispatch was in progress
+  int m_dispatchDepth{ 0 }; // Nesting level of running dispatches (a callback may publish again)
+  size_t m_rateLimitedCount{ 0 }; // Number of subscriptions with a maximum delivery rate
+  bool m_hasPendingChanges{ false }; // Set when the table was changed from inside a callback
   SubscriptionId m_nextId{ 0 }; // Incremental ID generator
-  T m_latestData{}; // Latest published data
+  std::shared_ptr<T> m_snapshot; // Latest published data, handed out as an immutable snapshot
+  uint64_t m_version{ 0 }; // Incremented on every publish
+  std::array<std::shared_ptr<T>, 4> m_snapshotPool; // Recycled snapshots, reused once no consumer holds them
+  bool m_deduplicate{ false }; // Publish-on-change enabled
+  bool m_timeFanOut{ false }; // Fan-out timing enabled
+  BrokerStats m_stats{}; // Consumer-side counters
+  std::atomic<uint64_t> m_publishCount{ 0 }; // Written only by the publishing thread, atomic for GetStats()
+  BrokerMode m_mode{ BrokerMode::Immediate }; // Delivery mode
+  std::unique_ptr<TripleBuffer<T>> m_exchange; // Producer to consumer hand-over, only used in Concurrent mode
+  std::unique_ptr<SpscQueue<T>> m_queue; // Producer to consumer queue, only used in ConcurrentQueued mode
+  std::atomic<uint64_t> m_queueDropCount{ 0 }; // Values the producer could not queue, written by the publishing thread
+  std::unique_ptr<T> m_producerState; // Latest value published, kept by the producer for PublishDelta() in concurrent modes
+  uint64_t m_deltaRevision{ 0 }; // Revision stamped by the last applied delta, owned by the publishing thread
+  Delegate<void(const T&)> m_producerHook; // Run on the publishing thread with every published value
 };
 } // namespace pacemaker
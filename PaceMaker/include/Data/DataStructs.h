@@ -1,90 +1,102 @@
 #pragma once
 
+#include <Data/Schema.h>
+#include <Data/StringTable.h>
+
 #include <vector>
-#include <string>
 #include <deque>
+#include <cstdint>
 
 namespace pacemaker
 {
+  // Lap, gap and session times in integer milliseconds: comparable, sortable and free to copy
+  using TimeMs = int32_t;
+
+  // Marks a time that is not set, e.g. no lap completed yet
+  constexpr TimeMs NO_TIME = INT32_MIN;
+
+  // Telemetry schemas, see Data/Schema.h. Each one declares a struct of the same name below.
+
   // Player data structure
-  struct PlayerData
-  {
-    int position;
-    int number;
-    std::string name;
-    std::string currentTime;    // Current lap time
-    std::string bestTime;       // Best lap time
-    std::string gap;            // Gap to leader
-    int teamColorIndex;         // 0=Red Bull, 1=Ferrari, 2=Mercedes, etc.
-    int batteryPercent;         // Battery percentage
-    bool inPit;                 // Is in pit
-  };
+  #define PACEMAKER_PLAYER_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                         \
+    FIELD(int, position, 0, "Position in the running order")                                                      \
+    FIELD(int, number, 0, "Car number")                                                                           \
+    FIELD(StringId, name, EMPTY_STRING_ID, "Driver name, interned")                                               \
+    FIELD(TimeMs, currentTime, NO_TIME, "Current lap time, NO_TIME if not set")                                   \
+    FIELD(TimeMs, bestTime, NO_TIME, "Best lap time, NO_TIME if not set")                                         \
+    FIELD(TimeMs, gap, NO_TIME, "Gap to leader, NO_TIME if not set")                                              \
+    FIELD(int, teamColorIndex, 0, "0=Red Bull, 1=Ferrari, 2=Mercedes, etc.")                                      \
+    FIELD(int, batteryPercent, 0, "Battery percentage")                                                           \
+    FIELD(bool, inPit, false, "Is in pit")                                                                        \
+    FIELD(uint64_t, revision, 0, "Delta revision that last changed this row, 0 if it arrived in a whole update")
 
   // Leaderboard data structure
-  struct LeaderboardData
-  {
-    std::vector<PlayerData> players;
-    std::string sessionType;
-    std::string sessionTime;
-  };
-
-  // Relative timing player structure
-  struct RelativePlayer
-  {
-    int position;
-    int number;
-    std::string name;
-    std::string teamCode;       // e.g., "HY", "GT3"
-    float gap;                  // Gap in seconds (positive = ahead, negative = behind)
-    int teamColorIndex;
-  };
+  #define PACEMAKER_LEADERBOARD_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                    \
+    LIST(PlayerData, players, "Rows in position order")                                                           \
+    FIELD(StringId, sessionType, EMPTY_STRING_ID, "E.g. \"Practice\", interned")                                  \
+    FIELD(TimeMs, sessionTime, NO_TIME, "Remaining session time")                                                 \
+    FIELD(uint64_t, revision, 0, "Delta revision of the last applied LeaderboardDelta, 0 for a whole update")
 
   // Tire data structure
-  struct TireData
-  {
-    float temperatures[4];      // FL, FR, RL, RR temperatures
-    float pressures[4];         // FL, FR, RL, RR pressures
-    float wear[4];             // FL, FR, RL, RR wear percentage
-  };
+  #define PACEMAKER_TIRE_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                           \
+    ARRAY(float, temperatures, 4, "FL, FR, RL, RR temperatures")                                                  \
+    ARRAY(float, pressures, 4, "FL, FR, RL, RR pressures")                                                        \
+    ARRAY(float, wear, 4, "FL, FR, RL, RR wear percentage")
 
   // Vehicle data structure
-  struct VehicleData
-  {
-    int speed;                  // Speed in MPH or KPH
-    int gear;                   // Current gear
-    float rpm;                  // RPM (0-1 normalized)
-    float engineTemp;           // Engine temperature
-    float oilTemp;              // Oil temperature
-    float fuelPercent;          // Fuel percentage
-    float ersPercent;           // ERS percentage
-    bool drsEnabled;            // DRS active
-    std::string lapTime;        // Current lap time
-    std::string lastLap;        // Last lap time
-  };
+  #define PACEMAKER_VEHICLE_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                        \
+    FIELD(int, speed, 0, "Speed in MPH or KPH")                                                                   \
+    FIELD(int, gear, 0, "Current gear")                                                                           \
+    FIELD(float, rpm, 0.0f, "RPM (0-1 normalized)")                                                               \
+    FIELD(float, engineTemp, 0.0f, "Engine temperature")                                                          \
+    FIELD(float, oilTemp, 0.0f, "Oil temperature")                                                                \
+    FIELD(float, fuelPercent, 0.0f, "Fuel percentage")                                                            \
+    FIELD(float, ersPercent, 0.0f, "ERS percentage")                                                              \
+    FIELD(bool, drsEnabled, false, "DRS active")                                                                  \
+    FIELD(TimeMs, lapTime, NO_TIME, "Current lap time")                                                           \
+    FIELD(TimeMs, lastLap, NO_TIME, "Last lap time")                                                              \
+    FIELD(float, lapDistance, 0.0f, "Fraction of the lap covered, 0 (start/finish line) to 1")
+
+  // Relative timing player structure
+  #define PACEMAKER_RELATIVE_PLAYER_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                \
+    FIELD(int, position, 0, "Position in the running order")                                                      \
+    FIELD(int, number, 0, "Car number")                                                                           \
+    FIELD(StringId, name, EMPTY_STRING_ID, "Driver name, interned")                                               \
+    FIELD(StringId, teamCode, EMPTY_STRING_ID, "e.g., \"HY\", \"GT3\", interned")                                 \
+    FIELD(TimeMs, gap, 0, "Gap (positive = ahead, negative = behind)")                                            \
+    FIELD(int, teamColorIndex, 0, "Index into the team colors")
+
+  #define PACEMAKER_RELATIVE_TIMING_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                \
+    LIST(RelativePlayerData, players, "Cars around the player, nearest ahead to nearest behind")                  \
+    FIELD(int, playerPosition, 0, "Position of the player's car")
+
+  #define PACEMAKER_INPUT_TELEMETRY_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                \
+    FIELD(float, steering, 0.0f, "-1.0 (left) to 1.0 (right)")                                                   \
+    FIELD(float, throttle, 0.0f, "0.0 to 1.0")                                                                    \
+    FIELD(float, brake, 0.0f, "0.0 to 1.0")                                                                       \
+    FIELD(short, gear, 1, "-1=Reverse, 0=Neutral, 1+=Forward gears")                                              \
+    FIELD(float, rpm, 1.85f, "Engine RPM (0 to 10000)")
 
-  struct RelativePlayerData
-  {
-    int position;
-    int number;
-    std::string name;
-    std::string teamCode;
-    float gap;  // Gap in seconds (positive = ahead, negative = behind)
-    int teamColorIndex;
-  };
+  // Live delta to the best lap, see Data/LapDeltaEngine.h
+  #define PACEMAKER_LAP_DELTA_DATA_SCHEMA(FIELD, ARRAY, LIST)                                                      \
+    FIELD(TimeMs, delta, NO_TIME, "Lap time minus the best lap's at this distance, NO_TIME without one")          \
+    FIELD(TimeMs, predictedLapTime, NO_TIME, "Best lap time plus delta")                                          \
+    FIELD(TimeMs, bestLapTime, NO_TIME, "Best lap time")                                                          \
+    FIELD(int, sector, 0, "Sector the car is in, 0 to 2")                                                         \
+    ARRAY(TimeMs, sectorDeltas, 3, "Per sector time minus the best lap's; live in the current one, NO_TIME ahead")
 
-  struct RelativeTimingData
-  {
-    std::vector<RelativePlayerData> players;
-    int playerPosition;
-  };
+  PACEMAKER_SCHEMA_STRUCT(PlayerData, PACEMAKER_PLAYER_DATA_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(LeaderboardData, PACEMAKER_LEADERBOARD_DATA_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(TireData, PACEMAKER_TIRE_DATA_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(VehicleData, PACEMAKER_VEHICLE_DATA_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(RelativePlayerData, PACEMAKER_RELATIVE_PLAYER_DATA_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(RelativeTimingData, PACEMAKER_RELATIVE_TIMING_DATA_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(InputTelemetryData, PACEMAKER_INPUT_TELEMETRY_DATA_SCHEMA,
+    static constexpr int MAX_HISTORY = 200;)
+  PACEMAKER_SCHEMA_STRUCT(LapDeltaData, PACEMAKER_LAP_DELTA_DATA_SCHEMA,
+    static constexpr int SECTOR_COUNT = 3;)
 
-  struct InputTelemetryData
-  {
-    float steering;     // -1.0 (left) to 1.0 (right)
-    float throttle;     // 0.0 to 1.0
-    float brake;        // 0.0 to 1.0
-    short gear{1};         // -1=Reverse, 0=Neutral, 1+=Forward gears
-    float rpm{1.85f};   // Engine RPM (0 to 10000)
-    static constexpr int MAX_HISTORY = 200;
-  };
-} // namespace pacemaker
\ No newline at end of file
+  // Same shapes under the names the overlays use
+  using RelativePlayer = RelativePlayerData;
+  using TireInfoData = TireData;
+} // namespace pacemaker
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Data/DataStructs.h>
+#include <Data/StringTable.h>
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+namespace pacemaker
+{
+  class DirtyRowSet;
+
+  /**
+   * @brief Structure-of-arrays storage for the whole grid: one contiguous column per field.
+   *        Sorting by position, summing gaps or scanning for cars in the pit touches only the columns involved,
+   *        instead of dragging every car's full row through the cache. Rows keep the order they were assigned in
+   *        until SortByPosition() is called.
+   */
+  class FieldTable
+  {
+  public:
+    /**
+     * @brief Read-only view of one car, gathered from the columns. Members mirror PlayerData.
+     */
+    struct RowView
+    {
+      int position;
+      int number;
+      StringId name;
+      StringId teamCode;
+      TimeMs currentTime;
+      TimeMs bestTime;
+      TimeMs gap;
+      int teamColorIndex;
+      int batteryPercent;
+      bool inPit;
+    };
+
+    /** @brief Replaces the grid with the leaderboard's rows. */
+    void Assign(std::span<const PlayerData> players);
+
+    /** @brief Replaces the grid with the relative timing rows. */
+    void Assign(std::span<const RelativePlayerData> players);
+
+    /**
+     * @brief Copies only the dirty rows of a leaderboard into the grid; falls back to Assign() if the row count changed.
+     * @param players Rows of the leaderboard, in the order the grid was assigned from.
+     * @param dirtyRows Rows that changed since the grid was last updated.
+     */
+    void Update(std::span<const PlayerData> players, const DirtyRowSet& dirtyRows);
+
+    /** @brief Reorders all columns by ascending position. Cheap if the grid is already sorted. */
+    void SortByPosition();
+
+    /** @brief Counts the cars currently in the pit. */
+    [[nodiscard]] size_t CountInPit() const noexcept;
+
+    /**
+     * @brief Finds a car by number.
+     * @return The row index, or Size() if the car is not in the grid.
+     */
+    [[nodiscard]] size_t IndexOfNumber(int number) const noexcept;
+
+    /**
+     * @brief Finds the best lap time of the grid.
+     * @return The fastest set best time, or NO_TIME if no car has one.
+     */
+    [[nodiscard]] TimeMs FastestBestTime() const noexcept;
+
+    /** @brief Gathers the row at the given index. */
+    [[nodiscard]] RowView Row(size_t index) const noexcept;
+
+    /** @brief Gets the number of cars in the grid. */
+    [[nodiscard]] size_t Size() const noexcept { return m_positions.size(); }
+
+    // Column views, all Size() long and indexed alike
+    [[nodiscard]] std::span<const int32_t> Positions() const noexcept { return m_positions; }
+    [[nodiscard]] std::span<const int32_t> Numbers() const noexcept { return m_numbers; }
+    [[nodiscard]] std::span<const StringId> Names() const noexcept { return m_names; }
+    [[nodiscard]] std::span<const StringId> TeamCodes() const noexcept { return m_teamCodes; }
+    [[nodiscard]] std::span<const TimeMs> CurrentTimes() const noexcept { return m_currentTimes; }
+    [[nodiscard]] std::span<const TimeMs> BestTimes() const noexcept { return m_bestTimes; }
+    [[nodiscard]] std::span<const TimeMs> Gaps() const noexcept { return m_gaps; }
+    [[nodiscard]] std::span<const int32_t> TeamColorIndices() const noexcept { return m_teamColorIndices; }
+    [[nodiscard]] std::span<const int32_t> BatteryPercents() const noexcept { return m_batteryPercents; }
+    [[nodiscard]] std::span<const uint8_t> PitFlags() const noexcept { return m_pitFlags; }
+
+  private:
+    void Resize(size_t size);
+
+    template<typename Column>
+    void Permute(std::vector<Column>& column);
+
+    std::vector<int32_t> m_positions;
+    std::vector<int32_t> m_numbers;
+    std::vector<StringId> m_names;
+    std::vector<StringId> m_teamCodes;
+    std::vector<TimeMs> m_currentTimes;
+    std::vector<TimeMs> m_bestTimes;
+    std::vector<TimeMs> m_gaps;
+    std::vector<int32_t> m_teamColorIndices;
+    std::vector<int32_t> m_batteryPercents;
+    std::vector<uint8_t> m_pitFlags; // 1 if in pit
+
+    std::vector<uint32_t> m_order; // Sort permutation, kept to reuse its capacity
+    std::vector<std::byte> m_scratch; // Permutation buffer shared by all columns
+  };
+} // namespace pacemaker
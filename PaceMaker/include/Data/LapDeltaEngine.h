@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Data/DataStructs.h>
+
+#include <vector>
+#include <cstddef>
+
+namespace pacemaker
+{
+  /**
+   * @brief Computes the live delta to the best lap from the player's lap distance and lap time.
+   *        Laps are stored as the lap time at each of GRID_POINTS evenly spaced lap distances, resampled from whatever
+   *        rate the samples arrive at. Looking up the best lap at the current distance is one index computation and a
+   *        linear interpolation, so an update is O(1) and cheap enough for every input sample on the ingestion thread.
+   *        Only laps driven from line to line can become the best lap; a lap joined halfway is skipped.
+   *        Sectors are the lap's thirds.
+   *        E.g.:
+   *        if (engine.Update(vehicle.lapDistance, vehicle.lapTime, vehicle.lastLap))
+   *          lapDeltaBroker.Publish(engine.GetData());
+   */
+  class LapDeltaEngine
+  {
+  public:
+    static constexpr size_t GRID_POINTS = 1000;  // Samples per lap, 5 m apart on a 5 km track
+
+    LapDeltaEngine();
+
+    /** @brief Forgets the best lap and the current one, e.g. for a new session or track. */
+    void Reset();
+
+    /**
+     * @brief Advances to the player's latest sample.
+     * @param lapDistance Fraction of the lap covered, 0 to 1.
+     * @param lapTime Time into the current lap; NO_TIME skips the sample.
+     * @param lastLapTime Time of the last completed lap, taken as the lap's time when the line is crossed.
+     * @return true if GetData() changed.
+     */
+    bool Update(float lapDistance, TimeMs lapTime, TimeMs lastLapTime);
+
+    [[nodiscard]] const LapDeltaData& GetData() const noexcept { return m_data; }
+
+    /** @brief Checks if a best lap is set, so deltas are available. */
+    [[nodiscard]] bool HasBestLap() const noexcept { return m_data.bestLapTime != NO_TIME; }
+
+  private:
+    void Record(float lapDistance, TimeMs lapTime);
+    void CompleteLap(TimeMs lapTime);
+    void StartLap();
+    [[nodiscard]] float BestTimeAt(float lapDistance) const noexcept;
+    void ComputeDelta(float lapDistance, TimeMs lapTime);
+
+    std::vector<float> m_bestLap;     // Lap time at each grid point of the best lap, plus the lap time at the line
+    std::vector<float> m_currentLap;  // Same for the lap being driven, filled up to m_nextPoint
+    size_t m_nextPoint = 0;           // First grid point the current lap has not passed yet
+    bool m_isLapValid = false;        // The current lap started at the line
+    float m_lastDistance = -1.0f;     // Previous sample, -1 before the first one
+    TimeMs m_lastTime = NO_TIME;
+    LapDeltaData m_data;
+  };
+} // namespace pacemaker
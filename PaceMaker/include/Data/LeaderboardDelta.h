@@ -0,0 +1,123 @@
+#pragma once
+
+#include <Data/DataStructs.h>
+
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace pacemaker
+{
+  // Fields of a PlayerData row a RowPatch may carry, combined as a bit mask
+  enum RowField : uint16_t
+  {
+    ROW_FIELD_NAME = 1 << 0,
+    ROW_FIELD_CURRENT_TIME = 1 << 1,
+    ROW_FIELD_BEST_TIME = 1 << 2,
+    ROW_FIELD_GAP = 1 << 3,
+    ROW_FIELD_TEAM_COLOR = 1 << 4,
+    ROW_FIELD_BATTERY = 1 << 5,
+    ROW_FIELD_IN_PIT = 1 << 6,
+  };
+
+  // Partial update of one leaderboard row, keyed by car number
+  struct RowPatch
+  {
+    int number;                 // Car number of the row to patch
+    uint16_t fields;            // RowField bits of the members of values to copy into the row
+    PlayerData values;          // New values; members not selected by fields are ignored
+
+    bool operator==(const RowPatch&) const = default;
+  };
+
+  // Exchange of two rows' places in the running order, keyed by car number
+  struct PositionSwap
+  {
+    int numberA;
+    int numberB;
+
+    bool operator==(const PositionSwap&) const = default;
+  };
+
+  // Changes between two consecutive leaderboard states.
+  // Swaps are applied before patches, in order, so overtakes across several places are a chain of adjacent swaps.
+  struct LeaderboardDelta
+  {
+    std::vector<PositionSwap> swaps;
+    std::vector<RowPatch> patches;
+    std::optional<StringId> sessionType;
+    std::optional<TimeMs> sessionTime;
+
+    /** @brief Removes all changes, keeping the allocated capacity so steady-state ticks never allocate. */
+    void Clear()
+    {
+      swaps.clear();
+      patches.clear();
+      sessionType.reset();
+      sessionTime.reset();
+    }
+
+    /** @brief Checks if the delta carries no changes at all. */
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+      return swaps.empty() && patches.empty() && !sessionType && !sessionTime;
+    }
+
+    bool operator==(const LeaderboardDelta&) const = default;
+  };
+
+  /**
+   * @brief Applies a delta to a leaderboard in place. Rows are looked up by car number; swaps exchange the rows and their
+   *        positions. Every row that actually changed is stamped with the revision, as is the leaderboard itself if
+   *        anything changed; on top of a whole update (revision 0) all rows are stamped.
+   *        Patches and swaps naming unknown car numbers are ignored.
+   *        Found by DataBroker<LeaderboardData>::PublishDelta through argument-dependent lookup.
+   * @param data The leaderboard to update.
+   * @param delta The changes to apply.
+   * @param revision Revision to stamp on changed rows, must be greater than any revision already in data.
+   * @return true if data changed; false if every change in the delta was already present.
+   */
+  bool ApplyDelta(LeaderboardData& data, const LeaderboardDelta& delta, uint64_t revision);
+
+  /**
+   * @brief Bitmap of leaderboard row indices that changed since a consumer last looked at the leaderboard.
+   */
+  class DirtyRowSet
+  {
+  public:
+    /**
+     * @brief Marks the rows of data that changed after the given revision. All rows are marked for a whole update
+     *        (revision 0), if the row count changed or if the revision went backwards.
+     * @param data The leaderboard to inspect.
+     * @param sinceRevision Revision of the leaderboard the consumer saw last.
+     * @param previousRowCount Number of rows the consumer saw last.
+     */
+    void Collect(const LeaderboardData& data, uint64_t sinceRevision, size_t previousRowCount);
+
+    /** @brief Marks the first rowCount rows as dirty, e.g. after a re-layout. */
+    void MarkAll(size_t rowCount);
+
+    /** @brief Checks if the row at the given index is dirty. */
+    [[nodiscard]] bool IsDirty(size_t row) const noexcept
+    {
+      return row < m_rowCount && (m_words[row / WORD_BITS] >> (row % WORD_BITS)) & 1u;
+    }
+
+    /** @brief Checks if any row is dirty. */
+    [[nodiscard]] bool Any() const noexcept { return m_dirtyCount > 0; }
+
+    /** @brief Number of dirty rows. */
+    [[nodiscard]] size_t Count() const noexcept { return m_dirtyCount; }
+
+  private:
+    static constexpr size_t WORD_BITS = 64;
+
+    void Reset(size_t rowCount);
+    void Mark(size_t row) noexcept;
+
+    std::vector<uint64_t> m_words; // One bit per row
+    size_t m_rowCount{ 0 };        // Number of rows the bitmap covers
+    size_t m_dirtyCount{ 0 };      // Number of set bits
+  };
+} // namespace pacemaker
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+namespace pacemaker
+{
+  /**
+   * @brief Reduces a stream of samples to at most two points per bucket of samples, e.g. one bucket per pixel column
+   *        of a graph holding far more samples than it is wide. Each channel keeps its smallest and largest sample of
+   *        the bucket, in the order they arrived, so brake spikes and throttle lifts that fall between every n-th
+   *        sample stay on screen: drawn as a line, the two points cover exactly the pixels all samples would.
+   *        Works sample by sample: Push() costs the same whatever the history's length, and a bucket's points are
+   *        final once it completes, so the graph only appends them.
+   *        Buckets start at sample numbers that are multiples of the bucket size, so they do not shift as the window
+   *        scrolls and the graph does not shimmer.
+   *        E.g.:
+   *        downsampler.Reset(MinMaxDownsampler::BucketSizeFor(historySize, graphWidth), sampleNumber);
+   *        if (const size_t points = downsampler.Push(values))                  // On each sample
+   *          for (size_t point = 0; point < points; ++point) graph.Push(downsampler.GetPoint(point));
+   */
+  class MinMaxDownsampler
+  {
+  public:
+    static constexpr size_t MAX_POINTS_PER_BUCKET = 2;
+
+    /**
+     * @brief Gets the smallest bucket size that fits a number of samples into a number of columns.
+     */
+    [[nodiscard]] static size_t BucketSizeFor(size_t sampleCount, size_t columns) noexcept;
+
+    /**
+     * @param channelCount Values per sample.
+     */
+    explicit MinMaxDownsampler(size_t channelCount);
+
+    /**
+     * @brief Drops the open bucket and starts bucketing anew.
+     * @param bucketSize Samples per bucket; 1 passes every sample through as one point.
+     * @param nextSample Number of the next sample pushed, which places it in its bucket.
+     */
+    void Reset(size_t bucketSize, uint64_t nextSample) noexcept;
+
+    [[nodiscard]] size_t GetBucketSize() const noexcept { return m_bucketSize; }
+
+    /** @brief Gets the number of points a bucket is reduced to: 2, or 1 for buckets of a single sample. */
+    [[nodiscard]] size_t GetPointsPerBucket() const noexcept { return m_bucketSize > 1 ? MAX_POINTS_PER_BUCKET : 1; }
+
+    /** @brief Gets the number of the first sample of the open bucket, i.e. the end of the last completed one. */
+    [[nodiscard]] uint64_t GetBucketStart() const noexcept { return m_bucketStart; }
+
+    /**
+     * @brief Adds the next sample.
+     * @param values One value per channel.
+     * @return The number of points of the bucket the sample completed, read with GetPoint(), or 0.
+     */
+    size_t Push(std::span<const float> values) noexcept;
+
+    /**
+     * @brief Gets a point of the bucket completed last, one value per channel, oldest point first.
+     */
+    [[nodiscard]] std::span<const float> GetPoint(size_t point) const noexcept
+    {
+      return { &m_points[point * m_channelCount], m_channelCount };
+    }
+
+  private:
+    size_t m_channelCount;
+    size_t m_bucketSize = 1;
+    uint64_t m_bucketStart = 0;     // Sample number the open bucket starts at
+    uint64_t m_nextSample = 0;      // Sample number of the next Push()
+    std::vector<float> m_minimums;  // Smallest value of each channel in the open bucket
+    std::vector<float> m_maximums;  // Largest value of each channel in the open bucket
+    std::vector<uint8_t> m_isMaximumLast; // Per channel: the maximum arrived after the minimum
+    std::vector<float> m_points;    // Points of the last completed bucket, point by point, channel by channel
+  };
+} // namespace pacemaker
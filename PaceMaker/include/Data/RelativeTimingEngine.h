@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Data/DataStructs.h>
+
+#include <span>
+#include <vector>
+#include <cstddef>
+
+namespace pacemaker
+{
+  // Where a car is on track this tick, plus what a relative timing row shows about it
+  struct CarTrackState
+  {
+    int position = 0;                    // Position in the running order
+    int number = 0;                      // Car number
+    StringId name = EMPTY_STRING_ID;
+    StringId teamCode = EMPTY_STRING_ID;
+    int teamColorIndex = 0;
+    float lapDistance = 0.0f;            // Fraction of the lap covered, 0 (start/finish line) to 1
+    float speed = 0.0f;                  // Meters per second
+  };
+
+  /**
+   * @brief Computes relative timing, the cars nearest to the player on track, from the cars' lap-distance fractions and
+   *        speeds. Cars are kept ordered around the lap circle from one tick to the next; as they barely move between
+   *        ticks the order is repaired with an insertion sort, so an update is O(n) plus a pass per overtake or per car
+   *        crossing the line.
+   *        E.g.:
+   *        RelativeTimingEngine engine(5800.0f);
+   *        engine.Update(cars, playerIndex, relativeTimingData); // Every tick, with the same car at the same index
+   */
+  class RelativeTimingEngine
+  {
+  public:
+    static constexpr int DEFAULT_CARS_AROUND = 3;  // Rows above and below the player, as the overlay shows them
+    static constexpr float MIN_SPEED = 5.0f;       // m/s; slower cars (pit lane, spins) are timed as if at this speed
+
+    explicit RelativeTimingEngine(float trackLength, int carsAround = DEFAULT_CARS_AROUND);
+
+    void SetTrackLength(float meters) noexcept { m_trackLength = meters; }
+    [[nodiscard]] float GetTrackLength() const noexcept { return m_trackLength; }
+
+    /**
+     * @brief Orders the cars around the lap and fills out with the ones nearest the player: farthest ahead first, the
+     *        player with a gap of 0, then the ones behind. Gaps are the time the player needs to reach a car ahead, or
+     *        a car behind needs to reach the player, positive ahead and negative behind, wrapping around the line.
+     *        out's rows are overwritten in place, so steady-state updates do not allocate.
+     * @param cars All cars; a car keeps its index from one update to the next. A changed count starts over.
+     * @param playerIndex Index of the player's car in cars.
+     * @param out Receives the rows and the player's position.
+     */
+    void Update(std::span<const CarTrackState> cars, size_t playerIndex, RelativeTimingData& out);
+
+    /** @brief Gets the indices of the cars ordered by lap distance, as of the last Update(). */
+    [[nodiscard]] std::span<const size_t> GetTrackOrder() const noexcept { return m_order; }
+
+  private:
+    void SortByLapDistance(std::span<const CarTrackState> cars);
+
+    float m_trackLength;
+    int m_carsAround;
+    std::vector<size_t> m_order; // Car indices by ascending lap distance, nearly sorted between updates
+  };
+} // namespace pacemaker
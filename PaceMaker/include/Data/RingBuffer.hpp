@@ -0,0 +1,254 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define PACEMAKER_RING_BUFFER_SSE2 1
+#endif
+
+namespace pacemaker
+{
+
+/**
+* RingBuffer class template, a fixed-capacity history that keeps the newest Capacity() values.
+* Storage is one array allocated up front; Push() overwrites the oldest value once the ring is full, so a history
+* costs no allocation per sample and stays contiguous in memory, unlike a deque that grows and drops blocks.
+* Values are indexed oldest first. Any window of them is at most two contiguous runs, see GetSegments(), which is how
+* renderers and the queries below read it.
+* For arithmetic types the ring also answers MinMax(), Mean() and Decimate() over a window. They run over the runs with
+* LANES independent accumulators, a shape the compiler turns into SIMD adds without reassociating; float min/max use
+* SSE2 directly. A 30000-sample float window (60 s at 500 Hz) is reduced in a few microseconds.
+*/
+template<typename T>
+class RingBuffer
+{
+public:
+  // A window as contiguous runs, oldest first; second is empty unless the window wraps around the end of the storage
+  struct Segments
+  {
+    std::span<const T> first;
+    std::span<const T> second;
+  };
+
+  // Smallest and largest value of a window
+  struct Range
+  {
+    T min;
+    T max;
+  };
+
+  /**
+   * @brief Constructs an empty ring
+   * @param capacity Number of values kept, at least 1
+   */
+  explicit RingBuffer(size_t capacity)
+    : m_capacity(std::max<size_t>(capacity, 1))
+    , m_values(std::make_unique<T[]>(m_capacity))
+  {
+  }
+
+  RingBuffer(RingBuffer&&) noexcept = default;
+  RingBuffer& operator=(RingBuffer&&) noexcept = default;
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer& operator=(const RingBuffer&) = delete;
+
+  /**
+   * @brief Append a value, dropping the oldest one if the ring is full
+   */
+  void Push(const T& value) {
+    m_values[m_next] = value;
+    m_next = m_next + 1 == m_capacity ? 0 : m_next + 1;
+    m_size = std::min(m_size + 1, m_capacity);
+  }
+
+  /**
+   * @brief Forget all values; the storage is kept
+   */
+  void Clear() noexcept {
+    m_next = 0;
+    m_size = 0;
+  }
+
+  [[nodiscard]] size_t Capacity() const noexcept { return m_capacity; }
+  [[nodiscard]] size_t Size() const noexcept { return m_size; }
+  [[nodiscard]] bool Empty() const noexcept { return m_size == 0; }
+  [[nodiscard]] bool Full() const noexcept { return m_size == m_capacity; }
+
+  /**
+   * @brief Access a value by age
+   * @param index 0 for the oldest value, Size() - 1 for the newest
+   */
+  [[nodiscard]] const T& operator[](size_t index) const noexcept { return m_values[Physical(index)]; }
+
+  [[nodiscard]] const T& Front() const noexcept { return (*this)[0]; }
+  [[nodiscard]] const T& Back() const noexcept { return (*this)[m_size - 1]; }
+
+  /**
+   * @brief Access a window of values as contiguous runs
+   * @param first Index of the window's oldest value
+   * @param count Number of values; the window is clipped to the values held
+   */
+  [[nodiscard]] Segments GetSegments(size_t first, size_t count) const noexcept {
+    first = std::min(first, m_size);
+    count = std::min(count, m_size - first);
+    const size_t start = Physical(first);
+    const size_t run = std::min(count, m_capacity - start);
+    return { { &m_values[start], run }, { &m_values[0], count - run } };
+  }
+
+  /**
+   * @brief Access all values as contiguous runs, oldest first
+   */
+  [[nodiscard]] Segments GetSegments() const noexcept { return GetSegments(0, m_size); }
+
+  /**
+   * @brief Find the smallest and largest value of a window
+   * @return Range {T{}, T{}} for an empty window
+   */
+  [[nodiscard]] Range MinMax(size_t first, size_t count) const noexcept requires std::is_arithmetic_v<T> {
+    const Segments segments = GetSegments(first, count);
+    if (segments.first.empty())
+    {
+      return { T{}, T{} };
+    }
+
+    T low[LANES];
+    T high[LANES];
+    std::fill_n(low, LANES, segments.first[0]);
+    std::fill_n(high, LANES, segments.first[0]);
+    AccumulateMinMax(segments.first, low, high);
+    AccumulateMinMax(segments.second, low, high);
+    for (size_t lane = 1; lane < LANES; ++lane)
+    {
+      low[0] = low[lane] < low[0] ? low[lane] : low[0];
+      high[0] = high[0] < high[lane] ? high[lane] : high[0];
+    }
+    return { low[0], high[0] };
+  }
+
+  /**
+   * @brief Compute the mean of a window
+   * @return 0 for an empty window
+   */
+  [[nodiscard]] double Mean(size_t first, size_t count) const noexcept requires std::is_arithmetic_v<T> {
+    const Segments segments = GetSegments(first, count);
+    const size_t size = segments.first.size() + segments.second.size();
+    if (size == 0)
+    {
+      return 0.0;
+    }
+    return static_cast<double>(Sum(segments.first) + Sum(segments.second)) / static_cast<double>(size);
+  }
+
+  /**
+   * @brief Reduce a window to fewer values, e.g. one per pixel column, by averaging consecutive buckets.
+   *        The window is split into out.size() buckets of near-equal length, oldest first.
+   * @param out Receives one mean per bucket
+   * @return Number of values written: out.size(), or the window's size if it holds fewer values
+   */
+  size_t Decimate(size_t first, size_t count, std::span<T> out) const noexcept requires std::is_arithmetic_v<T> {
+    first = std::min(first, m_size);
+    count = std::min(count, m_size - first);
+    const size_t buckets = std::min(out.size(), count);
+    size_t begin = first;
+    for (size_t bucket = 0; bucket < buckets; ++bucket)
+    {
+      const size_t end = first + (bucket + 1) * count / buckets;
+      out[bucket] = static_cast<T>(Mean(begin, end - begin));
+      begin = end;
+    }
+    return buckets;
+  }
+
+private:
+  static constexpr size_t LANES = 8; // Independent accumulators, one 256-bit register of floats
+
+  // Integers are summed in 64 bits, floating point in its own type
+  using SumType = std::conditional_t<std::is_floating_point_v<T>, T, long long>;
+
+  [[nodiscard]] size_t Physical(size_t index) const noexcept {
+    const size_t oldest = m_next >= m_size ? m_next - m_size : m_next + m_capacity - m_size;
+    const size_t physical = oldest + index;
+    return physical >= m_capacity ? physical - m_capacity : physical;
+  }
+
+  static void AccumulateMinMax(std::span<const T> values, T (&low)[LANES], T (&high)[LANES]) noexcept {
+    const T* data = values.data();
+    const size_t count = values.size();
+    size_t i = 0;
+#ifdef PACEMAKER_RING_BUFFER_SSE2
+    if constexpr (std::is_same_v<T, float>)
+    {
+      // Compilers keep the generic loop's lanes in memory for floats, which costs as much as not vectorizing.
+      // minps/maxps compute exactly its (a < b ? a : b), NaN handling included.
+      __m128 low0 = _mm_loadu_ps(low);
+      __m128 low1 = _mm_loadu_ps(low + 4);
+      __m128 high0 = _mm_loadu_ps(high);
+      __m128 high1 = _mm_loadu_ps(high + 4);
+      for (; i + LANES <= count; i += LANES)
+      {
+        const __m128 block0 = _mm_loadu_ps(data + i);
+        const __m128 block1 = _mm_loadu_ps(data + i + 4);
+        low0 = _mm_min_ps(block0, low0);
+        low1 = _mm_min_ps(block1, low1);
+        high0 = _mm_max_ps(block0, high0);
+        high1 = _mm_max_ps(block1, high1);
+      }
+      _mm_storeu_ps(low, low0);
+      _mm_storeu_ps(low + 4, low1);
+      _mm_storeu_ps(high, high0);
+      _mm_storeu_ps(high + 4, high1);
+    }
+#endif
+    for (; i + LANES <= count; i += LANES)
+    {
+      for (size_t lane = 0; lane < LANES; ++lane)
+      {
+        const T value = data[i + lane];
+        low[lane] = value < low[lane] ? value : low[lane];
+        high[lane] = high[lane] < value ? value : high[lane];
+      }
+    }
+    for (; i < count; ++i)
+    {
+      low[0] = data[i] < low[0] ? data[i] : low[0];
+      high[0] = high[0] < data[i] ? data[i] : high[0];
+    }
+  }
+
+  [[nodiscard]] static SumType Sum(std::span<const T> values) noexcept {
+    const T* data = values.data();
+    const size_t count = values.size();
+    SumType lanes[LANES]{};
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES)
+    {
+      for (size_t lane = 0; lane < LANES; ++lane)
+      {
+        lanes[lane] += static_cast<SumType>(data[i + lane]);
+      }
+    }
+    for (; i < count; ++i)
+    {
+      lanes[0] += static_cast<SumType>(data[i]);
+    }
+
+    SumType sum{};
+    for (SumType lane : lanes)
+    {
+      sum += lane;
+    }
+    return sum;
+  }
+
+  size_t m_capacity; // Values kept
+  std::unique_ptr<T[]> m_values; // Ring storage
+  size_t m_next{ 0 }; // Slot the next value is written to
+  size_t m_size{ 0 }; // Values held, up to m_capacity
+};
+} // namespace pacemaker
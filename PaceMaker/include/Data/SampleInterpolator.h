@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <chrono>
+#include <cstddef>
+
+namespace pacemaker
+{
+  /**
+   * @brief Dead reckoning for values published slower than the frame rate, e.g. gaps at 10-20 Hz drawn at 144 Hz.
+   *        Holds any number of float channels (cars x fields) sampled together, and evaluates them at the present
+   *        frame time by extrapolating each channel's trend from its last two samples. A new sample does not snap
+   *        the shown value: the trajectory restarts from what is currently displayed and meets the extrapolated
+   *        sample one interval later, then holds, so values move continuously instead of stepping at each sample
+   *        and settle when the stream stops.
+   *        Channels are stored as plain arrays and updated by element-wise loops the compiler vectorizes, so
+   *        hundreds of channels cost well under a microsecond per frame.
+   *        E.g.:
+   *        if (reader.Poll()) interpolator.Push(now, gaps);
+   *        interpolator.Evaluate(now);
+   *        DrawGap(interpolator.GetValues()[row]);
+   */
+  class SampleInterpolator
+  {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr float DEFAULT_LEAD = 1.0f;  // Follow the trend a whole interval ahead, i.e. dead reckoning
+    static constexpr float MAX_INTERVAL = 1.0f;  // Seconds; samples further apart restart from rest
+
+    /**
+     * @param channelCount Number of channels, or 0 to take the count from the first sample.
+     * @param lead How far past each sample the trajectory aims, in sample intervals: 1 extrapolates to the present,
+     *             0 eases to each sample over one interval without ever overshooting it, at one interval of latency.
+     */
+    explicit SampleInterpolator(size_t channelCount = 0, float lead = DEFAULT_LEAD);
+
+    /** @brief Changes the number of channels. All channels start over from the next sample. */
+    void Resize(size_t channelCount);
+
+    [[nodiscard]] size_t Size() const noexcept { return m_values.size(); }
+
+    /**
+     * @brief Takes a new sample of every channel.
+     * @param time When the sample arrived.
+     * @param samples One value per channel; a different count resizes and starts over.
+     */
+    void Push(Clock::time_point time, std::span<const float> samples);
+
+    /**
+     * @brief Shows a channel's last sample as is and drops its trend, e.g. when a row now shows another car.
+     *        Call after Push() for the channels whose meaning changed with the sample.
+     */
+    void Snap(size_t channel) noexcept;
+
+    /** @brief Computes every channel's value at the given time, read back with GetValues(). */
+    void Evaluate(Clock::time_point time) noexcept;
+
+    /** @brief Gets the channels' values as of the last Evaluate(). */
+    [[nodiscard]] std::span<const float> GetValues() const noexcept { return m_values; }
+
+  private:
+    [[nodiscard]] float SecondsSince(Clock::time_point time) const noexcept;
+
+    float m_lead;
+    bool m_hasSample = false;         // A sample was pushed since the channels last started over
+    Clock::time_point m_sampleTime{}; // Arrival of the last sample, where the trajectories start
+    float m_interval = 0.0f;          // Seconds between the last two samples, how long the trajectories run
+    std::vector<float> m_samples;     // Last sample of each channel
+    std::vector<float> m_origins;     // Displayed value of each channel when the last sample arrived
+    std::vector<float> m_slopes;      // Units per second each channel moves from its origin
+    std::vector<float> m_values;      // Values at the last Evaluate()
+  };
+} // namespace pacemaker
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+#include <vector>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Declarative telemetry schema.
+ *
+ * A schema is an X-macro listing the fields of one struct. It is invoked with three macros, one per field kind:
+ *   FIELD(type, name, default, description)   a single value
+ *   ARRAY(type, name, count, description)     a fixed-size C array
+ *   LIST(type, name, description)             a std::vector of values or of other schema structs
+ *
+ * PACEMAKER_SCHEMA_STRUCT(Name, SCHEMA, ...) turns a schema into the struct itself (members in schema order,
+ * defaulted equality, anything passed as extra arguments pasted into the body) plus a Schema<Name> specialization with
+ * field metadata and a field visitor. Hashing (SchemaHash) and the binary codec (Data/BinaryCodec.h) are written once
+ * against the visitor, so every struct declared this way gets them for free.
+ */
+
+namespace pacemaker
+{
+  /** @brief Kind of a schema field. */
+  enum class FieldKind : uint8_t
+  {
+    Value,
+    Array,
+    List,
+  };
+
+  /** @brief Compile-time description of one schema field. */
+  struct FieldInfo
+  {
+    const char* name;         // Member name
+    const char* type;         // Element type as spelled in the schema
+    size_t offset;            // Byte offset of the member in the struct
+    size_t elementSize;       // sizeof one element
+    size_t count;             // Number of elements for arrays, 1 for values, 0 (variable) for lists
+    FieldKind kind;
+    const char* description;
+  };
+
+  /**
+   * @brief Schema traits of a struct declared with PACEMAKER_SCHEMA_STRUCT. Specializations provide
+   *        NAME, FIELDS (std::array<FieldInfo, N>), ForEachField(value, visitor) and ForEachFieldIndexed(value, visitor).
+   */
+  template<typename T>
+  struct Schema;
+
+  /** @brief Satisfied by structs declared with PACEMAKER_SCHEMA_STRUCT. */
+  template<typename T>
+  concept SchemaStruct = requires { Schema<std::remove_cv_t<T>>::FIELDS; };
+
+  /**
+   * @brief Visits every member of a schema struct in schema order as visitor(const char* name, member&).
+   *        Arrays are passed as C array references, lists as std::vector references.
+   */
+  template<typename T, typename Visitor>
+    requires SchemaStruct<T>
+  constexpr void ForEachField(T& value, Visitor&& visitor)
+  {
+    Schema<std::remove_cv_t<T>>::ForEachField(value, visitor);
+  }
+
+  /**
+   * @brief Visits every member like ForEachField(), as visitor(std::integral_constant<size_t, I>, member&) where I
+   *        indexes Schema<T>::FIELDS, so the visitor can branch on a field's metadata at compile time.
+   *        E.g. if constexpr (Schema<T>::FIELDS[decltype(field)::value].kind == FieldKind::List) ...
+   */
+  template<typename T, typename Visitor>
+    requires SchemaStruct<T>
+  constexpr void ForEachFieldIndexed(T& value, Visitor&& visitor)
+  {
+    Schema<std::remove_cv_t<T>>::ForEachFieldIndexed(value, visitor);
+  }
+
+  /**
+   * @brief Hash functor for schema structs, FNV-1a over the member values in schema order.
+   *        E.g. std::unordered_set<VehicleData, SchemaHash> seen;
+   */
+  struct SchemaHash
+  {
+    template<typename T>
+      requires SchemaStruct<T>
+    [[nodiscard]] size_t operator()(const T& value) const noexcept
+    {
+      uint64_t hash = FNV_OFFSET;
+      Mix(hash, value);
+      return static_cast<size_t>(hash);
+    }
+
+  private:
+    static constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+    static constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    template<typename T>
+    static void Mix(uint64_t& hash, const T& value) noexcept
+    {
+      if constexpr (SchemaStruct<T>)
+      {
+        ForEachField(value, [&hash](const char*, const auto& member) { Mix(hash, member); });
+      }
+      else if constexpr (std::is_array_v<T>)
+      {
+        for (const auto& element : value)
+        {
+          Mix(hash, element);
+        }
+      }
+      else if constexpr (requires { value.size(); value.begin(); })
+      {
+        MixBytes(hash, static_cast<uint64_t>(value.size()));
+        for (const auto& element : value)
+        {
+          Mix(hash, element);
+        }
+      }
+      else if constexpr (std::is_floating_point_v<T>)
+      {
+        // +0.0 and -0.0 compare equal, so they must hash alike
+        MixBytes(hash, value == T{} ? T{} : value);
+      }
+      else
+      {
+        static_assert(std::is_trivially_copyable_v<T>, "Schema fields must be scalars, arrays, lists or schema structs");
+        MixBytes(hash, value);
+      }
+    }
+
+    template<typename T>
+    static void MixBytes(uint64_t& hash, const T& value) noexcept
+    {
+      const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+      for (size_t i = 0; i < sizeof(T); ++i)
+      {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+      }
+    }
+  };
+} // namespace pacemaker
+
+// Member declarations
+#define PACEMAKER_SCHEMA_DECLARE_FIELD(type, name, init, description) type name{ init };
+#define PACEMAKER_SCHEMA_DECLARE_ARRAY(type, name, count, description) type name[count]{};
+#define PACEMAKER_SCHEMA_DECLARE_LIST(type, name, description) std::vector<type> name;
+
+// Field metadata, expanded inside Schema<Name> where Type names the struct
+#define PACEMAKER_SCHEMA_INFO_FIELD(type, name, init, description) \
+  ::pacemaker::FieldInfo{ #name, #type, offsetof(Type, name), sizeof(type), 1, ::pacemaker::FieldKind::Value, description },
+#define PACEMAKER_SCHEMA_INFO_ARRAY(type, name, count, description) \
+  ::pacemaker::FieldInfo{ #name, #type, offsetof(Type, name), sizeof(type), count, ::pacemaker::FieldKind::Array, description },
+#define PACEMAKER_SCHEMA_INFO_LIST(type, name, description) \
+  ::pacemaker::FieldInfo{ #name, #type, offsetof(Type, name), sizeof(type), 0, ::pacemaker::FieldKind::List, description },
+
+// Visitor calls
+#define PACEMAKER_SCHEMA_VISIT_FIELD(type, name, init, description) visitor(#name, value.name);
+#define PACEMAKER_SCHEMA_VISIT_ARRAY(type, name, count, description) visitor(#name, value.name);
+#define PACEMAKER_SCHEMA_VISIT_LIST(type, name, description) visitor(#name, value.name);
+
+// Visitor calls with the field's index in FIELDS
+#define PACEMAKER_SCHEMA_VISIT_INDEXED_FIELD(type, name, init, description) \
+  visitor(std::integral_constant<size_t, FieldIndex(#name)>{}, value.name);
+#define PACEMAKER_SCHEMA_VISIT_INDEXED_ARRAY(type, name, count, description) \
+  visitor(std::integral_constant<size_t, FieldIndex(#name)>{}, value.name);
+#define PACEMAKER_SCHEMA_VISIT_INDEXED_LIST(type, name, description) \
+  visitor(std::integral_constant<size_t, FieldIndex(#name)>{}, value.name);
+
+/**
+ * Declares struct Name from SCHEMA together with its Schema<Name> traits.
+ * Extra arguments are pasted into the struct body, e.g. static constants.
+ * Must be used at pacemaker namespace scope.
+ */
+#define PACEMAKER_SCHEMA_STRUCT(Name, SCHEMA, ...)                                                            \
+  struct Name                                                                                                 \
+  {                                                                                                           \
+    SCHEMA(PACEMAKER_SCHEMA_DECLARE_FIELD, PACEMAKER_SCHEMA_DECLARE_ARRAY, PACEMAKER_SCHEMA_DECLARE_LIST)     \
+    __VA_ARGS__                                                                                               \
+    bool operator==(const Name&) const = default;                                                             \
+  };                                                                                                          \
+  template<>                                                                                                  \
+  struct Schema<Name>                                                                                         \
+  {                                                                                                           \
+    using Type = Name;                                                                                        \
+    static constexpr const char* NAME = #Name;                                                                \
+    static constexpr auto FIELDS = std::to_array<FieldInfo>({                                                 \
+      SCHEMA(PACEMAKER_SCHEMA_INFO_FIELD, PACEMAKER_SCHEMA_INFO_ARRAY, PACEMAKER_SCHEMA_INFO_LIST) });        \
+    template<typename Value, typename Visitor>                                                                \
+    static constexpr void ForEachField(Value& value, Visitor&& visitor)                                       \
+    {                                                                                                         \
+      SCHEMA(PACEMAKER_SCHEMA_VISIT_FIELD, PACEMAKER_SCHEMA_VISIT_ARRAY, PACEMAKER_SCHEMA_VISIT_LIST)         \
+    }                                                                                                         \
+    static constexpr size_t FieldIndex(std::string_view name)                                                 \
+    {                                                                                                         \
+      size_t index = 0;                                                                                       \
+      while (index < FIELDS.size() && name != FIELDS[index].name)                                             \
+      {                                                                                                       \
+        ++index;                                                                                              \
+      }                                                                                                       \
+      return index;                                                                                           \
+    }                                                                                                         \
+    template<typename Value, typename Visitor>                                                                \
+    static constexpr void ForEachFieldIndexed(Value& value, Visitor&& visitor)                                \
+    {                                                                                                         \
+      SCHEMA(PACEMAKER_SCHEMA_VISIT_INDEXED_FIELD, PACEMAKER_SCHEMA_VISIT_INDEXED_ARRAY,                      \
+        PACEMAKER_SCHEMA_VISIT_INDEXED_LIST)                                                                  \
+    }                                                                                                         \
+  };
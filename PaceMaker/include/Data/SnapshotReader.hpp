@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Data/DataBroker.hpp>
+
+#include <memory>
+#include <cstdint>
+#include <chrono>
+
+namespace pacemaker
+{
+
+/**
+* SnapshotReader class template, the pull-side counterpart of a DataBroker subscription.
+* Holds on to the latest snapshot it picked up and the version it belongs to, so a consumer can poll once per frame
+* and skip copying and re-layout entirely while nothing new was published.
+*/
+template<typename T>
+class SnapshotReader
+{
+public:
+  /**
+   * @brief Constructs a reader starting from the broker's current snapshot
+   * @param broker The broker to pull from; must outlive the reader
+   * @param maxRateHz Maximum number of snapshots picked up per second, 0 picks up every change.
+   *                  Polls in between return false, so the consumer keeps showing the held snapshot (latest-wins).
+   */
+  explicit SnapshotReader(const DataBroker<T>& broker, double maxRateHz = 0.0)
+    : m_broker(&broker), m_snapshot(broker.GetSnapshot()), m_version(broker.GetVersion())
+  {
+    if (maxRateHz > 0.0)
+    {
+      m_period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / maxRateHz));
+    }
+  }
+
+  /**
+   * @brief Pick up the broker's latest snapshot if it changed since the previous poll and the reader is due
+   * @return true if Get() now refers to a newer snapshot
+   */
+  bool Poll() {
+    if (m_period != Clock::duration::zero())
+    {
+      const auto now = Clock::now();
+      if (now < m_nextDue || m_broker->GetVersion() == m_version)
+      {
+        return false;
+      }
+      m_nextDue = now + m_period;
+    }
+
+    auto snapshot = m_broker->TryGetSnapshot(m_version);
+    if (!snapshot)
+    {
+      return false;
+    }
+
+    m_snapshot = std::move(snapshot);
+    return true;
+  }
+
+  /**
+   * @brief Access the snapshot picked up by the last successful poll
+   * @return const T& Immutable data, valid until the next successful Poll()
+   */
+  [[nodiscard]] const T& Get() const noexcept { return *m_snapshot; }
+
+  /**
+   * @brief Access the version of the snapshot currently held
+   * @return uint64_t Broker version of Get()
+   */
+  [[nodiscard]] uint64_t GetVersion() const noexcept { return m_version; }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  const DataBroker<T>* m_broker{ nullptr }; // Broker to pull snapshots from
+  std::shared_ptr<const T> m_snapshot; // Latest snapshot picked up, shared with the broker
+  uint64_t m_version{ 0 }; // Version of m_snapshot
+  Clock::duration m_period{ Clock::duration::zero() }; // Minimum time between pick-ups, zero when not rate limited
+  Clock::time_point m_nextDue{}; // Earliest time of the next pick-up
+};
+} // namespace pacemaker
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace pacemaker
+{
+
+/**
+* SpscQueue class template, a bounded lock-free queue between exactly one producer thread and one consumer thread.
+* Storage is allocated once up front; elements are assigned into their slots, so types holding buffers keep their
+* capacity from lap to lap around the ring.
+*/
+template<typename T>
+class SpscQueue
+{
+public:
+  /**
+   * @brief Constructs a queue able to hold capacity elements
+   * @param capacity Maximum number of queued elements, rounded up to a power of two
+   */
+  explicit SpscQueue(size_t capacity)
+  {
+    size_t rounded = 1;
+    while (rounded < capacity)
+    {
+      rounded <<= 1;
+    }
+    m_mask = rounded - 1;
+    m_slots = std::make_unique<T[]>(rounded);
+  }
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  /**
+   * @brief Append a value. Only call from the producer thread.
+   * @param value The value to copy or move into the queue
+   * @return false if the queue is full and the value was not queued
+   */
+  template<typename U>
+  bool TryPush(U&& value) {
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_cachedHead > m_mask)
+    {
+      m_cachedHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_cachedHead > m_mask)
+      {
+        return false;
+      }
+    }
+
+    m_slots[tail & m_mask] = std::forward<U>(value);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Access the oldest queued value. Only call from the consumer thread.
+   * @return T* Pointer to the front element, or nullptr if the queue is empty. Valid until Pop().
+   */
+  [[nodiscard]] T* Front() noexcept {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_cachedTail)
+    {
+      m_cachedTail = m_tail.load(std::memory_order_acquire);
+      if (head == m_cachedTail)
+      {
+        return nullptr;
+      }
+    }
+    return &m_slots[head & m_mask];
+  }
+
+  /**
+   * @brief Release the front element back to the producer. Only call after Front() returned non-null.
+   */
+  void Pop() noexcept {
+    m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Access the capacity of the queue
+   */
+  [[nodiscard]] size_t Capacity() const noexcept { return m_mask + 1; }
+
+  /**
+   * @brief Access the number of queued elements. Callable from either thread; the count may be stale by the time it
+   *        is used, which is fine for flow control.
+   */
+  [[nodiscard]] size_t SizeApprox() const noexcept {
+    const size_t head = m_head.load(std::memory_order_acquire);
+    const size_t tail = m_tail.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+private:
+  static constexpr size_t CACHE_LINE = 64;
+
+  std::unique_ptr<T[]> m_slots; // Ring storage
+  size_t m_mask{ 0 }; // Capacity - 1
+  alignas(CACHE_LINE) std::atomic<size_t> m_head{ 0 }; // Next slot to read, written by the consumer
+  alignas(CACHE_LINE) size_t m_cachedTail{ 0 };        // Consumer's last view of m_tail
+  alignas(CACHE_LINE) std::atomic<size_t> m_tail{ 0 }; // Next slot to write, written by the producer
+  alignas(CACHE_LINE) size_t m_cachedHead{ 0 };        // Producer's last view of m_head
+};
+} // namespace pacemaker
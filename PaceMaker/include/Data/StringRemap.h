@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Data/Schema.h>
+#include <Data/StringTable.h>
+
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+
+namespace pacemaker
+{
+  /**
+   * @brief Translates StringIds of another string table (a recording, a remote sender) to ids of this process.
+   *        Apply() rewrites the members a schema declares as StringId, so telemetry structs decoded from foreign data
+   *        can be published like local ones.
+   */
+  class StringRemap
+  {
+  public:
+    void Clear() noexcept
+    {
+      m_ids.clear();
+      m_isIdentity = true;
+    }
+
+    /**
+     * @brief Maps a foreign id to a local one.
+     * @return false if the foreign id cannot be a valid id, nothing is mapped then.
+     */
+    bool Set(StringId from, StringId to)
+    {
+      if (from >= StringTable::CAPACITY)
+      {
+        return false;
+      }
+      if (from >= m_ids.size())
+      {
+        m_ids.resize(from + 1, EMPTY_STRING_ID);
+      }
+      m_ids[from] = to;
+      m_isIdentity = m_isIdentity && from == to;
+      return true;
+    }
+
+    /** @brief Checks if a foreign id has been mapped. */
+    [[nodiscard]] bool Contains(StringId from) const noexcept
+    {
+      return from == EMPTY_STRING_ID || (from < m_ids.size() && m_ids[from] != EMPTY_STRING_ID);
+    }
+
+    /** @brief Maps a foreign id; unknown ids become the empty string. */
+    [[nodiscard]] StringId Map(StringId from) const noexcept
+    {
+      return from < m_ids.size() ? m_ids[from] : EMPTY_STRING_ID;
+    }
+
+    /** @brief Checks if every mapping so far keeps the id, in which case Apply() can be skipped. */
+    [[nodiscard]] bool IsIdentity() const noexcept { return m_isIdentity; }
+
+    /** @brief Rewrites every StringId member of a schema struct, including those of nested structs and lists. */
+    template<typename T>
+      requires SchemaStruct<T>
+    void Apply(T& value) const
+    {
+      ForEachFieldIndexed(value, [this](auto field, auto& member) {
+        using Member = std::remove_cvref_t<decltype(member)>;
+        // StringId is an alias of uint32_t, only the schema's spelling tells them apart; it is known at compile time,
+        // so other integer members compile to nothing
+        constexpr bool isStringId = std::string_view(Schema<T>::FIELDS[decltype(field)::value].type) == "StringId";
+        if constexpr (SchemaStruct<Member>)
+        {
+          Apply(member);
+        }
+        else if constexpr (isStringId && std::is_same_v<Member, StringId>)
+        {
+          member = Map(member);
+        }
+        else if constexpr (requires { member.data(); member.size(); })
+        {
+          using Element = std::remove_cvref_t<decltype(*member.data())>;
+          if constexpr (SchemaStruct<Element> || (isStringId && std::is_same_v<Element, StringId>))
+          {
+            for (auto& element : member)
+            {
+              if constexpr (SchemaStruct<Element>)
+              {
+                Apply(element);
+              }
+              else
+              {
+                element = Map(element);
+              }
+            }
+          }
+        }
+      });
+    }
+
+  private:
+    std::vector<StringId> m_ids; // Indexed by foreign id
+    bool m_isIdentity = true;
+  };
+} // namespace pacemaker
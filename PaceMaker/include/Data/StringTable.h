@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace pacemaker
+{
+  // Id of an interned string; telemetry structs carry these instead of std::string so copies never allocate
+  using StringId = uint32_t;
+
+  // Id of the empty string, always present
+  constexpr StringId EMPTY_STRING_ID = 0;
+
+  /**
+   * @brief Session-wide intern table for driver names, team codes and other strings that repeat in telemetry.
+   *        The producer thread interns each distinct string once per session; any thread resolves ids without locking.
+   *        Strings are never moved or removed, so resolved pointers stay valid for the lifetime of the program.
+   */
+  class StringTable
+  {
+  public:
+    /**
+     * @brief Gets the singleton instance of the StringTable.
+     * @return Reference to the StringTable instance.
+     */
+    static StringTable& Instance();
+
+    /**
+     * @brief Returns the id of a string, adding it to the table the first time it is seen. Thread-safe.
+     *        Only allocates for strings not interned yet.
+     * @param text The string to intern.
+     * @return The id of the string, or EMPTY_STRING_ID if the table is full.
+     */
+    StringId Intern(std::string_view text);
+
+    /**
+     * @brief Resolves an id to a null-terminated string. Lock-free.
+     * @param id An id returned by Intern().
+     * @return The interned string, or "" for unknown ids.
+     */
+    [[nodiscard]] const char* CStr(StringId id) const noexcept;
+
+    /**
+     * @brief Resolves an id to a string view. Lock-free.
+     * @param id An id returned by Intern().
+     * @return The interned string, or an empty view for unknown ids.
+     */
+    [[nodiscard]] std::string_view View(StringId id) const noexcept;
+
+    /** @brief Gets the number of interned strings, including the empty string. */
+    [[nodiscard]] size_t Size() const noexcept { return m_count.load(std::memory_order_acquire); }
+
+    // Maximum number of strings, including the empty string; every valid id is below it
+    static constexpr size_t CAPACITY = 65536;
+
+  private:
+    StringTable();
+
+    [[nodiscard]] const std::string* Find(StringId id) const noexcept;
+
+    static constexpr size_t CHUNK_SIZE = 256;
+    static constexpr size_t MAX_CHUNKS = CAPACITY / CHUNK_SIZE;
+
+    // Fixed chunk directory: chunks are only ever added, so readers never see storage move under them
+    std::array<std::unique_ptr<std::string[]>, MAX_CHUNKS> m_chunks;
+    std::atomic<uint32_t> m_count{ 0 }; // Number of published entries; entries below it are immutable
+    std::mutex m_internMutex; // Serializes Intern()
+    std::unordered_map<std::string_view, StringId> m_index; // Views into the chunk storage, guarded by m_internMutex
+  };
+} // namespace pacemaker
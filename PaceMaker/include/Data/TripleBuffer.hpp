@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+namespace pacemaker
+{
+
+/**
+* TripleBuffer class template for handing the newest value from one producer thread to one consumer thread.
+* Neither side ever blocks or waits: the producer always owns a back slot to write into,
+* the consumer always owns a front slot to read from, and the third slot is swapped between them atomically.
+* Intermediate values are dropped (latest-wins), which is what a render loop wants from a sim running at 300-1000 Hz.
+*/
+template<typename T>
+class TripleBuffer
+{
+public:
+  /**
+   * @brief Access the slot owned by the producer. Only call from the producer thread.
+   * @return T& Reference to the back slot, filled in place and then made visible with Commit()
+   */
+  [[nodiscard]] T& WriteBuffer() noexcept { return m_slots[m_writeIndex].value; }
+
+  /**
+   * @brief Publish the back slot to the consumer and take over the previously shared slot.
+   *        Only call from the producer thread.
+   */
+  void Commit() noexcept {
+    const auto previous = m_shared.exchange(static_cast<uint8_t>(m_writeIndex | FRESH_BIT), std::memory_order_acq_rel);
+    m_writeIndex = previous & INDEX_MASK;
+  }
+
+  /**
+   * @brief Pick up the newest committed value, if any arrived since the last call.
+   *        Only call from the consumer thread.
+   * @return true if ReadBuffer() now refers to a newer value; false if nothing was committed meanwhile
+   */
+  [[nodiscard]] bool Fetch() noexcept {
+    if ((m_shared.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+    {
+      return false;
+    }
+
+    const auto previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+    m_readIndex = previous & INDEX_MASK;
+    return true;
+  }
+
+  /**
+   * @brief Access the slot owned by the consumer. Only call from the consumer thread.
+   * @return T& Reference to the front slot; stays untouched by the producer until the next Fetch()
+   */
+  [[nodiscard]] T& ReadBuffer() noexcept { return m_slots[m_readIndex].value; }
+
+private:
+  static constexpr uint8_t INDEX_MASK = 0x03;
+  static constexpr uint8_t FRESH_BIT = 0x04;
+  static constexpr size_t CACHE_LINE = 64;
+
+  // Each slot gets its own cache line so producer writes never false-share with consumer reads
+  struct alignas(CACHE_LINE) Slot
+  {
+    T value{};
+  };
+
+  std::array<Slot, 3> m_slots{};
+  alignas(CACHE_LINE) std::atomic<uint8_t> m_shared{ 1 }; // Index of the shared slot plus the fresh bit
+  alignas(CACHE_LINE) uint8_t m_writeIndex{ 0 };          // Producer-owned slot index
+  alignas(CACHE_LINE) uint8_t m_readIndex{ 2 };           // Consumer-owned slot index
+};
+} // namespace pacemaker
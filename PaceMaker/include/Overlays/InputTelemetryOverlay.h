@@ -7,6 +7,13 @@
 #include <Core/IDraggable.h>
 #include <Data/DataBroker.hpp>
 #include <Data/DataStructs.h>
+#include <Data/RingBuffer.hpp>
+#include <Data/MinMaxDownsampler.h>
+#include <Utils/TraceGraphBuffer.h>
+
+#include <deque>
+#include <span>
+#include <cstdint>
 
 // Forward declarations for Raylib
 struct Font;
@@ -20,18 +27,24 @@ namespace pacemaker
 class InputTelemetryOverlay : public BaseWidget, public IDataConsumer<InputTelemetryData>
 {
 public:
+  static constexpr double DEFAULT_HISTORY_RATE_HZ = 60.0; // One graph sample per 60 Hz tick, whatever the sim rate
+
   /**
    * @brief Constructs a new InputTelemetryOverlay.
    * @param bounds The initial bounds of the overlay.
    * @param minSize The minimum size of the overlay.
    * @param font The font to use for rendering text.
    * @param broker The data broker to subscribe to for input telemetry data.
+   * @param historySize Number of samples the graph spans.
+   * @param historyRateHz Samples taken into the history per second, e.g. 500 with 30000 samples for a minute.
    */
   InputTelemetryOverlay(
     Bounds bounds,
     MinSize minSize,
     Font* font,
-    DataBroker<InputTelemetryData>& broker
+    DataBroker<InputTelemetryData>& broker,
+    size_t historySize = InputTelemetryData::MAX_HISTORY,
+    double historyRateHz = DEFAULT_HISTORY_RATE_HZ
   );
 
   /**
@@ -45,13 +58,61 @@ public:
   void OnDataUpdated(const InputTelemetryData& data) override;
 
   /**
-   * @copydoc IRenderable::Render
+   * @brief Rebuckets the graph's points when a resize changes how many samples share a pixel column.
+   */
+  void Update(float deltaTime) override;
+
+  /**
+   * @copydoc BaseWidget::ReleaseGraphicsResources
    */
-  void Render() const override;
+  void ReleaseGraphicsResources() override;
+
+protected:
+  /**
+   * @copydoc BaseWidget::RenderContent
+   */
+  void RenderContent() const override;
 
 private:
+  // Traces of m_traces, in the order of the values pushed
+  enum Trace : size_t
+  {
+    TRACE_THROTTLE,
+    TRACE_BRAKE,
+    TRACE_STEERING,
+    TRACE_COUNT
+  };
+
+  // Gear change between two forward gears, marked on the graph
+  struct GearShift
+  {
+    uint64_t sample; // Sample number of the first sample in the new gear
+    bool isUpshift;
+  };
+
+  /**
+   * @brief Adds a sample to the downsampler and the points of the buckets it completes to the graph.
+   */
+  void AddToGraph(std::span<const float> values);
+
+  /**
+   * @brief Starts the graph over with buckets of the given number of samples, from the samples in the history.
+   */
+  void RebuildGraph(size_t bucketSize);
+
+  /**
+   * @brief Draws the traces with one DrawLineEx() per point and trace, where the GPU trace buffer is not available.
+   */
+  void DrawTracesLineByLine(float graphX, float xStep, std::span<const TraceGraphBuffer::TraceLayout> layouts) const;
+
   InputTelemetryData m_data{}; // Latest telemetry data
-  std::deque<InputTelemetryData> m_history; // History of telemetry data for graphing
+  size_t m_historySize; // Samples the graph spans
+  RingBuffer<float> m_history[TRACE_COUNT]; // Throttle, brake and steering samples, oldest first
+  uint64_t m_sampleCount{ 0 }; // Samples received, numbering the history
+  MinMaxDownsampler m_downsampler; // Reduces the samples to at most two points per pixel column of the graph
+  RingBuffer<float> m_points[TRACE_COUNT]; // Graph points of each trace, oldest first
+  TraceGraphBuffer m_traces; // The same points in a GPU vertex buffer, all traces drawn in one call
+  std::deque<GearShift> m_gearShifts; // Gear changes still within the history
   DataBroker<InputTelemetryData>::SubscriptionId m_subscriptionId{ 0 }; // Subscription ID for data updates
   Font* m_font{ nullptr }; // Font used for rendering text
 };
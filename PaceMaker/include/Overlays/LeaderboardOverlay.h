@@ -1,12 +1,15 @@
 #pragma once
 
 #include <Core/Widgets/BaseWidget.h>
-#include <Core/IDataConsumer.h>
 #include <Core/IRenderable.h>
 #include <Core/IConfigurable.h>
 #include <Core/IDraggable.h>
 #include <Data/DataBroker.hpp>
+#include <Data/SnapshotReader.hpp>
 #include <Data/DataStructs.h>
+#include <Data/LeaderboardDelta.h>
+#include <Data/FieldTable.h>
+#include <Data/SampleInterpolator.h>
 
 #include <vector>
 #include <span>
@@ -19,9 +22,9 @@ namespace pacemaker
 {
 
 /**
- * @brief UI widget that displays a leaderboard, consumes leaderboard data updates, and renders player rows.
+ * @brief UI widget that displays a leaderboard, pulls leaderboard snapshots, and renders player rows.
  */
-class LeaderboardOverlay : public BaseWidget, public IDataConsumer<LeaderboardData>
+class LeaderboardOverlay : public BaseWidget
 {
 
 public:
@@ -32,6 +35,7 @@ public:
    * @param font Pointer to the Font used for rendering text in the overlay.
    * @param teamColors A read-only span of Colors used to color teams in the leaderboard.
    * @param broker Reference to a DataBroker<LeaderboardData> that provides and updates the leaderboard data.
+   *               Must outlive the overlay.
    */
   LeaderboardOverlay(
     Bounds bounds,
@@ -47,31 +51,74 @@ public:
   ~LeaderboardOverlay() override = default;
 
   /**
-   * @brief IDataConsumer implementation called when new data is available.
-   * @param data The updated leaderboard data.
+   * @brief IWidget implementation, picks up a newer leaderboard snapshot, re-formats the text of the rows that changed
+   *        and lays rows out again only if the data or the bounds changed.
+   * @param deltaTime The time elapsed since the last update, in seconds.
    */
-  void OnDataUpdated(const LeaderboardData& data) override { m_data = data; }
+  void Update(float deltaTime) override;
 
+protected:
   /**
-   * @brief IRenderable implementation renders the leaderboard overlay.
+   * @brief BaseWidget implementation renders the leaderboard overlay, into the render cache when it was invalidated.
    */
-  void Render() const override;
+  void RenderContent() const override;
+
+  /**
+   * @brief BaseWidget implementation, rows are 500 pixels wide and may run past the bottom edge on a full grid.
+   */
+  Bounds GetContentBounds() const override;
 
 private:
+  // Row text formatted when the row changes instead of every frame; gap and battery when their shown value changes
+  struct RowText
+  {
+    char position[8];
+    char number[8];
+    char battery[8];
+    char gap[16];
+    TimeMs shownGap;
+    int shownBattery;
+  };
+
+  /**
+   * @brief Refreshes the grid columns and re-formats the cached text of the header and of the rows that changed since
+   *        the previously picked up snapshot.
+   * @param data The snapshot just picked up.
+   */
+  void RefreshRowText(const LeaderboardData& data);
+
+  /**
+   * @brief Moves the gap and battery columns on to the present frame time and re-formats the rows whose shown gap or
+   *        battery changed.
+   * @param hasNewData If true, a snapshot was just picked up and its values are pushed as a new sample.
+   */
+  void UpdateSmoothedColumns(bool hasNewData);
+
   /**
    * @brief Renders a single player's row in the UI at the specified position. This const method does not modify the object's observable state.
-   * @param player Reference to the PlayerData containing the information to display (name, score, avatar, etc.).
+   * @param player View of the grid row containing the information to display (name, score, avatar, etc.).
+   * @param text Pre-formatted numbers of the row.
    * @param x The x-coordinate (typically pixels) of the row's left edge.
    * @param y The y-coordinate (typically pixels) of the row's top edge.
    * @param rowHeight The height (typically in pixels) of the row to draw.
    * @param isHighlighted If true, render the row in its highlighted/selected style; otherwise render normally.
    */
-  void DrawPlayerRow(const PlayerData& player, int x, int y, int rowHeight, bool isHighlighted) const;
+  void DrawPlayerRow(const FieldTable::RowView& player, const RowText& text, int x, int y, int rowHeight, bool isHighlighted) const;
 
 // Private members
 private:
-  LeaderboardData m_data{}; // Current leaderboard data
-  DataBroker<LeaderboardData>::SubscriptionId m_subscriptionId{ 0 }; // Subscription ID for data updates
+  SnapshotReader<LeaderboardData> m_reader; // Current leaderboard snapshot, shared with the broker
+  Bounds m_layoutBounds{}; // Bounds the row layout was computed for
+  int m_rowHeight{ 35 }; // Row height for the current snapshot and bounds
+  FieldTable m_grid; // Column copy of the snapshot's players, only dirty rows are refreshed
+  std::vector<RowText> m_rowText; // Cached row text, indexed like the snapshot's players
+  SampleInterpolator m_columns; // Gap then battery channel per row, so they move smoothly between snapshots
+  std::vector<float> m_columnSamples; // Gaps in milliseconds, then battery percentages, of the latest snapshot
+  std::vector<int> m_rowNumbers; // Car shown in each row, to restart a row's channels when the car changes
+  DirtyRowSet m_dirtyRows; // Rows whose text changed with the last picked up snapshot
+  uint64_t m_rowTextRevision{ 0 }; // Leaderboard revision the row text was formatted for
+  char m_sessionTimeText[16]{}; // Cached session clock text
+  TimeMs m_sessionTimeFormatted{ NO_TIME }; // Session time m_sessionTimeText was formatted for
   Font* m_font{ nullptr }; // Font used for rendering text
   std::span<const Color> m_teamColors; // Read-only span of team colors
 };
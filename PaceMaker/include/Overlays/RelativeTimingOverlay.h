@@ -1,10 +1,12 @@
 #pragma once
 
 #include <Core/Widgets/BaseWidget.h>
-#include <Core/IDataConsumer.h>
 #include <Core/IRenderable.h>
 #include <Data/DataBroker.hpp>
+#include <Data/SnapshotReader.hpp>
 #include <Data/DataStructs.h>
+#include <Data/FieldTable.h>
+#include <Data/SampleInterpolator.h>
 
 #include <vector>
 #include <span>
@@ -16,7 +18,7 @@ struct Font;
 namespace pacemaker
 {
 
-class RelativeTimingOverlay : public BaseWidget, public IDataConsumer<RelativeTimingData>
+class RelativeTimingOverlay : public BaseWidget
 {
 public:
     RelativeTimingOverlay(
@@ -29,15 +31,34 @@ public:
 
     ~RelativeTimingOverlay() override = default;
 
-    void OnDataUpdated(const RelativeTimingData& data) override { m_data = data; }
-    void Render() const override;
+    void Update(float deltaTime) override;
+
+protected:
+    void RenderContent() const override;
+    Bounds GetContentBounds() const override;
 
 private:
-    void DrawPlayerRow(const RelativePlayerData& player, int x, int y, int rowHeight, bool isPlayer, int width) const;
+    // Row text formatted when a new snapshot arrives instead of every frame; the gap when its shown tenth changes
+    struct RowText
+    {
+        char position[8];
+        char gap[16];
+        TimeMs shownGap;
+    };
+
+    void UpdateGaps(bool hasNewData);
+
+    void DrawPlayerRow(const FieldTable::RowView& player, const RowText& text, int x, int y, int rowHeight, bool isPlayer, int width) const;
 
 private:
-    RelativeTimingData m_data{};
-    DataBroker<RelativeTimingData>::SubscriptionId m_subscriptionId{ 0 };
+    SnapshotReader<RelativeTimingData> m_reader;
+    FieldTable m_grid;
+    std::vector<RowText> m_rowText;
+    SampleInterpolator m_gaps;          // One channel per row, so gaps count smoothly between snapshots
+    std::vector<float> m_gapSamples;    // Gaps of the latest snapshot in milliseconds, as pushed to m_gaps
+    std::vector<int> m_rowNumbers;      // Car shown in each row, to restart a row's gap when the car changes
+    Bounds m_layoutBounds{};
+    int m_rowHeight{ 38 };
     Font* m_font{ nullptr };
     std::span<const Color> m_teamColors;
 };
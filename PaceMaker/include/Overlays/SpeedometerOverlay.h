@@ -1,10 +1,11 @@
 #pragma once
 
 #include <Core/Widgets/BaseWidget.h>
-#include <Core/IDataConsumer.h>
 #include <Core/IRenderable.h>
 #include <Data/DataBroker.hpp>
+#include <Data/SnapshotReader.hpp>
 #include <Data/DataStructs.h>
+#include <Data/SampleInterpolator.h>
 
 #include <string>
 
@@ -15,7 +16,7 @@ struct Font;
 namespace pacemaker
 {
 
-class SpeedometerOverlay : public BaseWidget, public IDataConsumer<VehicleData>
+class SpeedometerOverlay : public BaseWidget
 {
 public:
     SpeedometerOverlay(
@@ -27,12 +28,24 @@ public:
 
     ~SpeedometerOverlay() override = default;
 
-    void OnDataUpdated(const VehicleData& data) override { m_data = data; }
-    void Render() const override;
+    void Update(float deltaTime) override;
+
+protected:
+    void RenderContent() const override;
 
 private:
-    VehicleData m_data{};
-    DataBroker<VehicleData>::SubscriptionId m_subscriptionId{ 0 };
+    // Channels of m_dials
+    enum Dial : size_t
+    {
+        DIAL_RPM,
+        DIAL_SPEED,
+        DIAL_COUNT
+    };
+
+    SnapshotReader<VehicleData> m_reader;
+    SampleInterpolator m_dials{ DIAL_COUNT }; // RPM arc and speed, moving smoothly between vehicle samples
+    char m_lapTimeText[16]{}; // Lap times formatted when they change instead of every frame
+    char m_lastLapText[16]{};
     Font* m_font{ nullptr };
 };
 
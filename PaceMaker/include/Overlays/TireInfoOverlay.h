@@ -1,9 +1,9 @@
 #pragma once
 
 #include <Core/Widgets/BaseWidget.h>
-#include <Core/IDataConsumer.h>
 #include <Core/IRenderable.h>
 #include <Data/DataBroker.hpp>
+#include <Data/SnapshotReader.hpp>
 #include <Data/DataStructs.h>
 
 // Forward declarations
@@ -13,14 +13,7 @@ struct Font;
 namespace pacemaker
 {
 
-struct TireInfoData
-{
-    float temperatures[4];  // FL, FR, RL, RR
-    float pressures[4];     // FL, FR, RL, RR
-    float wear[4];          // FL, FR, RL, RR (percentage)
-};
-
-class TireInfoOverlay : public BaseWidget, public IDataConsumer<TireInfoData>
+class TireInfoOverlay : public BaseWidget
 {
 public:
     TireInfoOverlay(
@@ -32,12 +25,14 @@ public:
 
     ~TireInfoOverlay() override = default;
 
-    void OnDataUpdated(const TireInfoData& data) override { m_data = data; }
-    void Render() const override;
+    void Update(float deltaTime) override;
+
+protected:
+    void RenderContent() const override;
+    Bounds GetContentBounds() const override;
 
 private:
-    TireInfoData m_data{};
-    DataBroker<TireInfoData>::SubscriptionId m_subscriptionId{ 0 };
+    SnapshotReader<TireInfoData> m_reader;
     Font* m_font{ nullptr };
 };
 
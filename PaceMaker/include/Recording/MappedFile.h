@@ -0,0 +1,88 @@
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /**
+   * @brief File accessed through a shared memory mapping: append-only when created, read-only when opened.
+   *        Appending is a memcpy into the mapping; the OS writes the pages back in the background, and what was
+   *        appended survives a crash of the process. The file grows in large steps by remapping, so the pointer
+   *        returned by Data() is only valid until the next Append(). Reading touches only the pages used, so seeking
+   *        in a large file costs nothing up front. Not thread-safe; one thread owns the file.
+   */
+  class MappedFile
+  {
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Creates (or truncates) a file and maps its first capacity bytes.
+     * @param path File to create.
+     * @param capacity Initial size of the mapping; the file grows past it as needed.
+     * @return false if the file could not be created or mapped.
+     */
+    bool Create(const std::filesystem::path& path, size_t capacity);
+
+    /**
+     * @brief Maps an existing file read-only; Size() is the file size.
+     * @return false if the file does not exist, is empty or could not be mapped.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    /**
+     * @brief Appends bytes at the end of the written range, growing the file if they do not fit.
+     * @return false if the file is read-only or could not grow; nothing is written then.
+     */
+    bool Append(std::span<const std::byte> bytes);
+
+    /**
+     * @brief Overwrites bytes inside the written range, e.g. a header rewritten as the file grows.
+     * @return false if the file is read-only or the range is not inside Size().
+     */
+    bool WriteAt(size_t offset, std::span<const std::byte> bytes);
+
+    /** @brief Starts writing the dirty pages back to disk without waiting for it. */
+    void Flush();
+
+    /** @brief Unmaps and closes the file, trimming a created file to the written size. */
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_data != nullptr; }
+
+    /** @brief Gets the number of bytes written, or the size of an opened file. */
+    [[nodiscard]] size_t Size() const noexcept { return m_size; }
+
+    /** @brief Gets the mapped size of the file. */
+    [[nodiscard]] size_t Capacity() const noexcept { return m_capacity; }
+
+    /** @brief Gets the written bytes; invalidated by Append() and Close(). */
+    [[nodiscard]] std::span<const std::byte> Data() const noexcept { return { m_data, m_size }; }
+
+  private:
+    bool Map(size_t capacity);
+    void Unmap();
+
+    // Growth doubles the mapping up to this step, then grows linearly
+    static constexpr size_t MAX_GROWTH_STEP = size_t{ 256 } << 20;
+
+    std::byte* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_capacity = 0;
+    bool m_writable = false;
+
+#ifdef _WIN32
+    void* m_file = nullptr;     // HANDLE, kept opaque so windows.h stays out of headers
+    void* m_mapping = nullptr;  // HANDLE of the file mapping object
+#else
+    int m_file = -1;
+#endif
+  };
+} // namespace pacemaker
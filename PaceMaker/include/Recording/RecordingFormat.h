@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Data/DataStructs.h>
+#include <Data/Schema.h>
+#include <Data/StringTable.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Session recording file layout (.pmrec), all little-endian and encoded with BinaryCodec:
+ *
+ *   RecordingHeader                 RECORDING_HEADER_SIZE bytes
+ *   frame*                          dataSize bytes
+ *     RecordingFrameHeader          RECORDING_FRAME_HEADER_SIZE bytes
+ *     payload                       payloadSize bytes, the BinaryCodec encoding of the topic's struct
+ *
+ *   RecordingIndex                  indexSize bytes at indexOffset, written when the recording is closed
+ *
+ * Every frame holds a complete value of its topic, so the state at any point in time is the latest frame of each topic.
+ * The index stores that state once per RECORDING_KEYFRAME_INTERVAL_NS as a keyframe (the offset of each topic's latest
+ * frame), which bounds a seek to one keyframe lookup plus at most one interval of frames. It also lists the lap
+ * boundaries and every interned string.
+ *
+ * Payloads carry interned StringIds, so every string the session interned is written as a String frame before the
+ * first frame that can refer to it. The header is rewritten after every batch, which keeps frameCount and dataSize
+ * valid up to the last batch even if the process dies; such a recording has no index (indexSize 0) and the replay
+ * rebuilds it with one pass over the frames. The file may be longer than the header says, the tail is unused mapping
+ * space.
+ */
+
+namespace pacemaker
+{
+  /** @brief File signature, the first eight bytes of a recording. */
+  inline constexpr char RECORDING_MAGIC[8] = { 'P', 'M', 'R', 'E', 'C', 'O', 'R', 'D' };
+
+  inline constexpr uint32_t RECORDING_VERSION = 3; // 3: VehicleData::lapDistance
+
+  /** @brief Recording time between two keyframes of the index. */
+  inline constexpr int64_t RECORDING_KEYFRAME_INTERVAL_NS = 1'000'000'000;
+
+  /** @brief Marks a topic without any frame before a keyframe. */
+  inline constexpr uint64_t RECORDING_NO_OFFSET = UINT64_MAX;
+
+  /** @brief Topic of a recorded frame, selecting the struct its payload decodes to. */
+  enum class RecordingTopic : uint16_t
+  {
+    String,          // RecordingStringEntry
+    Leaderboard,     // LeaderboardData
+    RelativeTiming,  // RelativeTimingData
+    TireInfo,        // TireData
+    Vehicle,         // VehicleData
+    InputTelemetry,  // InputTelemetryData
+  };
+
+  inline constexpr size_t RECORDING_TOPIC_COUNT = static_cast<size_t>(RecordingTopic::InputTelemetry) + 1;
+
+#define PACEMAKER_RECORDING_HEADER_SCHEMA(FIELD, ARRAY, LIST)                                                          \
+  ARRAY(char, magic, 8, "RECORDING_MAGIC")                                                                             \
+  FIELD(uint32_t, version, RECORDING_VERSION, "Format version")                                                        \
+  FIELD(uint32_t, headerSize, 0, "Encoded size of this header, frames start right after it")                           \
+  FIELD(int64_t, startTimeNs, 0, "Wall-clock start of the recording in nanoseconds since the Unix epoch")              \
+  FIELD(int64_t, durationNs, 0, "Timestamp of the last frame written")                                                 \
+  FIELD(uint64_t, frameCount, 0, "Number of frames written, including string frames")                                  \
+  FIELD(uint64_t, dataSize, 0, "Bytes of frame data following the header")                                             \
+  FIELD(uint64_t, indexOffset, 0, "File offset of the RecordingIndex, 0 if the recording was not closed")              \
+  FIELD(uint64_t, indexSize, 0, "Encoded size of the RecordingIndex")
+
+#define PACEMAKER_RECORDING_FRAME_HEADER_SCHEMA(FIELD, ARRAY, LIST)                                                    \
+  FIELD(uint32_t, payloadSize, 0, "Bytes of payload following the frame header")                                       \
+  FIELD(RecordingTopic, topic, RecordingTopic::String, "Struct the payload decodes to")                                \
+  FIELD(uint16_t, flags, 0, "Reserved, zero")                                                                          \
+  FIELD(int64_t, timestampNs, 0, "Time the recorder received the value, in nanoseconds since the recording started")
+
+#define PACEMAKER_RECORDING_STRING_ENTRY_SCHEMA(FIELD, ARRAY, LIST)                                                    \
+  FIELD(StringId, id, EMPTY_STRING_ID, "Id the string had in the recording session")                                   \
+  LIST(char, text, "String contents, not null-terminated")
+
+#define PACEMAKER_RECORDING_KEYFRAME_SCHEMA(FIELD, ARRAY, LIST)                                                        \
+  FIELD(int64_t, timestampNs, 0, "Recording time of the keyframe")                                                     \
+  FIELD(uint64_t, offset, 0, "File offset of the first frame at or after the keyframe")                                \
+  ARRAY(uint64_t, topicOffsets, RECORDING_TOPIC_COUNT, "Latest frame of each topic before offset, or RECORDING_NO_OFFSET")
+
+#define PACEMAKER_RECORDING_LAP_SCHEMA(FIELD, ARRAY, LIST)                                                             \
+  FIELD(uint32_t, lap, 0, "Lap number counted from the start of the recording, the first lap seen is 1")               \
+  FIELD(int64_t, timestampNs, 0, "Recording time the lap started")                                                     \
+  FIELD(TimeMs, previousLapTime, NO_TIME, "Time of the lap that ended here, NO_TIME for the first lap")
+
+#define PACEMAKER_RECORDING_INDEX_SCHEMA(FIELD, ARRAY, LIST)                                                           \
+  LIST(RecordingStringEntry, strings, "Every string interned during the recording, in id order")                       \
+  LIST(RecordingKeyframe, keyframes, "One keyframe per RECORDING_KEYFRAME_INTERVAL_NS, in time order")                 \
+  LIST(RecordingLap, laps, "Lap boundaries, in time order")
+
+  PACEMAKER_SCHEMA_STRUCT(RecordingHeader, PACEMAKER_RECORDING_HEADER_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(RecordingFrameHeader, PACEMAKER_RECORDING_FRAME_HEADER_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(RecordingStringEntry, PACEMAKER_RECORDING_STRING_ENTRY_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(RecordingKeyframe, PACEMAKER_RECORDING_KEYFRAME_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(RecordingLap, PACEMAKER_RECORDING_LAP_SCHEMA)
+  PACEMAKER_SCHEMA_STRUCT(RecordingIndex, PACEMAKER_RECORDING_INDEX_SCHEMA)
+
+  // Both headers are fixed-size on the wire
+  inline constexpr size_t RECORDING_HEADER_SIZE = 8 + 4 + 4 + 8 + 8 + 8 + 8 + 8 + 8;
+  inline constexpr size_t RECORDING_FRAME_HEADER_SIZE = 4 + 2 + 2 + 8;
+} // namespace pacemaker
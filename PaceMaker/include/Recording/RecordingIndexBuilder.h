@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Data/DataStructs.h>
+#include <Recording/RecordingFormat.h>
+
+#include <string_view>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /**
+   * @brief Builds the RecordingIndex of a session from its frames, fed in file order.
+   *        Used by the recorder while recording and by the replay to rebuild the index of a recording that was never
+   *        closed, so both produce the same keyframes and laps.
+   */
+  class RecordingIndexBuilder
+  {
+  public:
+    RecordingIndexBuilder() { Reset(); }
+
+    /** @brief Forgets everything, ready for a new session. */
+    void Reset();
+
+    /**
+     * @brief Registers a frame. Emits a keyframe in front of it once a keyframe interval has passed since the previous.
+     * @param topic Topic of the frame.
+     * @param offset File offset of the frame header.
+     * @param timestampNs Timestamp of the frame, not lower than the previous frame's.
+     */
+    void AddFrame(RecordingTopic topic, uint64_t offset, int64_t timestampNs);
+
+    /** @brief Registers an interned string; ids arrive in increasing order. */
+    void AddString(StringId id, std::string_view text);
+
+    /**
+     * @brief Watches vehicle data for lap boundaries; the lap starts when the current lap time falls back.
+     *        The first vehicle frame starts lap 1.
+     */
+    void AddVehicle(const VehicleData& vehicle, int64_t timestampNs);
+
+    [[nodiscard]] const RecordingIndex& Index() const noexcept { return m_index; }
+
+    /** @brief Moves the index out, leaving the builder reset. */
+    [[nodiscard]] RecordingIndex TakeIndex();
+
+  private:
+    RecordingIndex m_index;
+    uint64_t m_topicOffsets[RECORDING_TOPIC_COUNT]; // Latest frame of each topic so far
+    int64_t m_nextKeyframeNs = 0;
+    TimeMs m_lapTime = NO_TIME; // Lap time of the previous vehicle frame
+  };
+} // namespace pacemaker
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <Data/BinaryCodec.h>
+#include <Data/DataBroker.hpp>
+#include <Data/StringTable.h>
+#include <Recording/MappedFile.h>
+#include <Recording/RecordingFormat.h>
+#include <Recording/RecordingIndexBuilder.h>
+#include <Utils/Delegate.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /** @brief Counters of a recording session. */
+  struct RecorderStats
+  {
+    uint64_t frames = 0;   // Frames written to the file, including string frames
+    uint64_t bytes = 0;    // Bytes written to the file, including the header
+    uint64_t batches = 0;  // Batches handed to the writer thread
+    bool failed = false;   // The file could not grow; everything after the failure was discarded
+  };
+
+  /**
+   * @brief Records broker traffic to a memory-mapped session file (see Recording/RecordingFormat.h).
+   *        Each Record() call subscribes to one broker; every value the subscription delivers is timestamped and
+   *        encoded into an in-memory batch on the thread that calls Dispatch(). Full batches are handed to a writer
+   *        thread without ever blocking the dispatching thread, and the writer copies them into the mapping.
+   *        Concurrent brokers deliver the latest value per Dispatch(), ConcurrentQueued brokers every value, so the
+   *        recording holds exactly what the overlays were shown.
+   *        E.g.:
+   *        SessionRecorder recorder;
+   *        if (recorder.Start("session.pmrec"))
+   *        {
+   *          recorder.Record(vehicleBroker, RecordingTopic::Vehicle);
+   *        }
+   */
+  class SessionRecorder
+  {
+  public:
+    struct Options
+    {
+      size_t batchBytes = size_t{ 64 } << 10;            // A batch is handed over once it holds this many bytes...
+      std::chrono::milliseconds flushInterval{ 250 };    // ...or once it is this old, whichever comes first
+      size_t initialCapacity = size_t{ 64 } << 20;       // Initial size of the file mapping
+    };
+
+    SessionRecorder() = default;
+    ~SessionRecorder();
+
+    SessionRecorder(const SessionRecorder&) = delete;
+    SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+    /**
+     * @brief Creates the session file and starts the writer thread.
+     * @return false if the file could not be created; the recorder stays idle.
+     */
+    bool Start(const std::filesystem::path& path, const Options& options);
+    bool Start(const std::filesystem::path& path) { return Start(path, Options{}); }
+
+    /**
+     * @brief Records every value a broker delivers under the given topic until Stop().
+     *        Call from the broker's consumer thread, like any other Subscribe(). The broker must outlive the
+     *        recording or the recorder must be stopped first.
+     */
+    template<typename T>
+    void Record(DataBroker<T>& broker, RecordingTopic topic)
+    {
+      if (!IsRecording())
+      {
+        return;
+      }
+
+      auto id = broker.Subscribe([this, topic](const T& value) { Append(topic, value); });
+      m_subscriptions.emplace_back([&broker, id]() { broker.Unsubscribe(id); });
+    }
+
+    /**
+     * @brief Unsubscribes from all brokers, writes the last batch and the seek index and closes the file.
+     *        Call from the consumer thread.
+     */
+    void Stop();
+
+    [[nodiscard]] bool IsRecording() const noexcept { return m_writer.joinable(); }
+
+    /** @brief Gets the counters; exact once Stop() returned, approximate while recording. */
+    [[nodiscard]] RecorderStats GetStats() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    template<typename T>
+    void Append(RecordingTopic topic, const T& value)
+    {
+      const auto now = Clock::now();
+      AppendNewStrings(now);
+      const int64_t timestampNs = AppendFrameHeader(topic, BinaryCodec::EncodedSize(value), now);
+      BinaryCodec::Encode(value, m_batch);
+      if constexpr (std::is_same_v<T, VehicleData>)
+      {
+        m_index.AddVehicle(value, timestampNs);
+      }
+      SubmitIfDue(now);
+    }
+
+    void AppendNewStrings(Clock::time_point now);
+    int64_t AppendFrameHeader(RecordingTopic topic, size_t payloadSize, Clock::time_point now);
+    void SubmitIfDue(Clock::time_point now);
+    void WriterLoop(std::stop_token stopToken);
+    void WriteBatch(std::span<const std::byte> batch, uint64_t frames, int64_t lastTimestampNs);
+    void WriteIndex();
+
+    Options m_options;
+    Clock::time_point m_startTime;
+    std::vector<Delegate<void()>> m_subscriptions; // Unsubscribes one broker each
+
+    // Dispatching thread
+    std::vector<std::byte> m_batch;           // Frames not yet handed over
+    uint64_t m_batchOffset = 0;               // File offset the batch will be written at
+    uint64_t m_batchFrames = 0;
+    int64_t m_batchEndNs = 0;                 // Timestamp of the newest frame in the batch
+    Clock::time_point m_lastSubmit;
+    size_t m_stringsRecorded = 0;             // Interned strings already written, ids below it are known to the file
+    RecordingStringEntry m_stringEntry;       // Reused so string frames do not allocate
+    RecordingIndexBuilder m_index;            // Keyframes and laps, written behind the frames by Stop()
+
+    // Handover, guarded by m_mutex; the inbox is empty while the writer is ready for the next batch
+    mutable std::mutex m_mutex;
+    std::condition_variable_any m_wake;
+    std::vector<std::byte> m_inbox;
+    uint64_t m_inboxFrames = 0;
+    int64_t m_inboxEndNs = 0;
+    RecorderStats m_stats;
+
+    // Writer thread
+    MappedFile m_file;
+    RecordingHeader m_header;
+    std::vector<std::byte> m_headerBytes;
+    bool m_writeFailed = false;
+    std::jthread m_writer;
+  };
+} // namespace pacemaker
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <Data/BinaryCodec.h>
+#include <Data/DataBroker.hpp>
+#include <Data/StringRemap.h>
+#include <Recording/MappedFile.h>
+#include <Recording/RecordingFormat.h>
+#include <Utils/Delegate.hpp>
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace pacemaker
+{
+  /** @brief How a replayed topic treats frames that fall between two Advance() calls. */
+  enum class ReplayPolicy
+  {
+    Latest,  // Only the newest frame is published, for topics that show the current state
+    Stream,  // Every frame is published up to 1x; faster, every n-th frame at n x speed, for sample histories
+  };
+
+  /**
+   * @brief Plays a session recording (see Recording/RecordingFormat.h) back into the brokers it was recorded from,
+   *        taking the place of the live telemetry producer.
+   *        Seeking restores the state from the nearest keyframe of the index and replays at most one keyframe
+   *        interval of frame headers, so it costs the same anywhere in a recording of any length. Recordings that were
+   *        never closed have their index rebuilt on Open(). All calls must come from one thread, which then is the
+   *        brokers' producer thread.
+   *        E.g.:
+   *        SessionReplay replay;
+   *        replay.Open("session.pmrec");
+   *        replay.Attach(vehicleBroker, RecordingTopic::Vehicle);
+   *        replay.SeekToLap(143);
+   *        replay.Advance(tickDuration); // each tick
+   */
+  class SessionReplay
+  {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr double MIN_SPEED = 0.25;
+    static constexpr double MAX_SPEED = 100.0;
+
+    SessionReplay() = default;
+
+    SessionReplay(const SessionReplay&) = delete;
+    SessionReplay& operator=(const SessionReplay&) = delete;
+
+    /**
+     * @brief Opens a recording and interns its strings; playback starts at the beginning.
+     * @return false if the file is missing, not a recording or of another format version.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_file.IsOpen(); }
+
+    /**
+     * @brief Publishes the frames of a topic to a broker from now on.
+     * @param broker Broker to publish to; must outlive the replay.
+     * @param topic Recorded topic, whose payloads decode to T.
+     * @param policy How frames between two Advance() calls are published.
+     */
+    template<typename T>
+    void Attach(DataBroker<T>& broker, RecordingTopic topic, ReplayPolicy policy = ReplayPolicy::Latest)
+    {
+      const auto slot = static_cast<size_t>(topic);
+      if (topic == RecordingTopic::String || slot >= RECORDING_TOPIC_COUNT)
+      {
+        return;
+      }
+
+      Channel& channel = m_channels[slot];
+      channel.policy = policy;
+      channel.publish = [this, &broker, value = std::make_unique<T>()](std::span<const std::byte> payload) {
+        if (BinaryCodec::Decode(payload, *value) == 0)
+        {
+          return;
+        }
+        if (!m_strings.IsIdentity())
+        {
+          m_strings.Apply(*value);
+        }
+        broker.Publish(*value);
+      };
+    }
+
+    /**
+     * @brief Moves playback to a point in time and publishes the state of every attached topic at that time.
+     * @param timestampNs Recording time, clamped to the recording.
+     */
+    void Seek(int64_t timestampNs);
+
+    /**
+     * @brief Moves playback to the start of a lap, counted from the start of the recording.
+     * @return false if the recording has no such lap.
+     */
+    bool SeekToLap(uint32_t lap);
+
+    /**
+     * @brief Plays the frames that fall into the given wall-clock time, scaled by the playback speed.
+     * @param elapsed Wall-clock time since the previous call.
+     */
+    void Advance(Clock::duration elapsed);
+
+    /** @brief Sets the playback speed, clamped to [MIN_SPEED, MAX_SPEED]. */
+    void SetSpeed(double speed);
+    [[nodiscard]] double GetSpeed() const noexcept { return m_speed; }
+
+    void SetPaused(bool paused) noexcept { m_paused = paused; }
+    [[nodiscard]] bool IsPaused() const noexcept { return m_paused; }
+
+    /** @brief Checks if playback reached the end of the recording. */
+    [[nodiscard]] bool IsFinished() const noexcept { return m_cursor >= m_dataEnd; }
+
+    /** @brief Gets the current recording time. */
+    [[nodiscard]] int64_t GetPosition() const noexcept { return m_position; }
+
+    /** @brief Gets the recording time of the last frame. */
+    [[nodiscard]] int64_t GetDuration() const noexcept { return m_header.durationNs; }
+
+    /** @brief Gets the lap boundaries of the recording. */
+    [[nodiscard]] std::span<const RecordingLap> GetLaps() const noexcept { return m_index.laps; }
+
+  private:
+    struct Channel
+    {
+      Delegate<void(std::span<const std::byte>)> publish; // Decodes a payload and publishes it, empty if not attached
+      ReplayPolicy policy = ReplayPolicy::Latest;
+      uint64_t pendingOffset = RECORDING_NO_OFFSET;        // Newest frame not published yet
+      uint64_t streamCounter = 0;                          // Frames seen, for decimating streams
+    };
+
+    bool ReadFrame(uint64_t offset, RecordingFrameHeader& header, std::span<const std::byte>& payload) const;
+    void PlayUntil(int64_t timestampNs, bool collapseStreams);
+    void PublishPending();
+    void RebuildIndex();
+    void InternStrings();
+
+    MappedFile m_file;
+    RecordingHeader m_header;
+    RecordingIndex m_index;
+    StringRemap m_strings; // Recorded id to local id
+    std::array<Channel, RECORDING_TOPIC_COUNT> m_channels;
+
+    uint64_t m_dataBegin = 0;   // File offset of the first frame
+    uint64_t m_dataEnd = 0;     // File offset behind the last frame
+    uint64_t m_cursor = 0;      // File offset of the next frame to play
+    int64_t m_position = 0;     // Current recording time
+    double m_speed = 1.0;
+    uint64_t m_streamStride = 1; // Every n-th frame of a stream is published
+    bool m_paused = false;
+  };
+} // namespace pacemaker
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Core/ITelemetrySource.h>
+#include <Recording/SessionReplay.h>
+
+#include <filesystem>
+
+namespace pacemaker
+{
+  /**
+   * @brief Plays a session recording back into the brokers (see Recording/SessionReplay.h).
+   *        Playback holds while the sinks are saturated, so fast replays do not overrun the input queue.
+   */
+  class ReplaySource : public ITelemetrySource
+  {
+  public:
+    struct Options
+    {
+      std::filesystem::path path;
+      double speed = 1.0;
+      uint32_t lap = 0; // Lap to start at, 0 for the beginning
+    };
+
+    explicit ReplaySource(Options options);
+
+    [[nodiscard]] const char* GetName() const override { return "replay"; }
+    [[nodiscard]] SourceMode GetMode() const override { return SourceMode::Polling; }
+
+    bool Open(TelemetrySinks& sinks) override;
+    void Poll(std::chrono::steady_clock::duration elapsed) override;
+    void Close() override;
+    [[nodiscard]] std::string GetStatus() const override;
+
+  private:
+    Options m_options;
+    SessionReplay m_replay;
+  };
+} // namespace pacemaker
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <Core/ITelemetrySource.h>
+#include <DataReader/SharedTelemetryReader.h>
+
+namespace pacemaker
+{
+  /**
+   * @brief Publishes telemetry a sim writes to shared memory (see DataReader/SharedTelemetryReader.h).
+   *        Only the newest frame of each topic is kept in shared memory, so nothing can pile up behind a slow consumer.
+   */
+  class SharedMemorySource : public ITelemetrySource
+  {
+  public:
+    explicit SharedMemorySource(const SharedTelemetryReader::Options& options);
+
+    [[nodiscard]] const char* GetName() const override { return "shm"; }
+    [[nodiscard]] SourceMode GetMode() const override { return SourceMode::Async; }
+
+    bool Open(TelemetrySinks& sinks) override;
+    [[nodiscard]] IngestTask Ingest(IngestExecutor& executor) override;
+    void Close() override;
+    [[nodiscard]] std::string GetStatus() const override;
+
+  private:
+    SharedTelemetryReader::Options m_options;
+    SharedTelemetryReader m_reader;
+  };
+} // namespace pacemaker
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Core/ITelemetrySource.h>
+#include <DataReader/IngestExecutor.h>
+#include <Utils/Config.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace pacemaker
+{
+  /**
+   * @brief Runs telemetry sources together on one ingestion thread, feeding the brokers.
+   *        Every source is a pipeline of an IngestExecutor: async sources suspend until their socket or shared memory
+   *        has data, polling sources are resumed by a timer at their poll interval and held back while the sinks are
+   *        saturated. Sharing the thread keeps it the brokers' one producer thread, however many sources run.
+   *        E.g.:
+   *        TelemetrySourceManager manager(sinks);
+   *        manager.Start(CreateTelemetrySources(config));
+   */
+  class TelemetrySourceManager
+  {
+  public:
+    explicit TelemetrySourceManager(const TelemetrySinks& sinks);
+    ~TelemetrySourceManager();
+
+    TelemetrySourceManager(const TelemetrySourceManager&) = delete;
+    TelemetrySourceManager& operator=(const TelemetrySourceManager&) = delete;
+
+    /**
+     * @brief Stops the running sources, opens the new ones and starts the ingestion thread with those that opened.
+     * @return Number of sources running; sources that could not be opened are dropped.
+     */
+    size_t Start(std::vector<std::unique_ptr<ITelemetrySource>> sources);
+    bool Start(std::unique_ptr<ITelemetrySource> source);
+
+    /** @brief Stops the ingestion thread and closes the sources. */
+    void Stop();
+
+    [[nodiscard]] bool IsRunning() const noexcept { return m_worker.joinable(); }
+
+    /** @brief Gets the names of the running sources, e.g. "udp+shm", or "none". */
+    [[nodiscard]] std::string GetSourceNames() const;
+
+    /** @brief Gets the status the sources reported when they were stopped, one "name (status)" each. */
+    [[nodiscard]] const std::string& GetLastStatus() const noexcept { return m_lastStatus; }
+
+    /** @brief Gets the number of polls held back because the sinks were saturated. */
+    [[nodiscard]] uint64_t GetThrottledPolls() const noexcept { return m_throttledPolls.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the ingestion thread's counters; exact once stopped. */
+    [[nodiscard]] const IngestExecutor::Stats& GetExecutorStats() const noexcept { return m_executor.GetStats(); }
+
+  private:
+    IngestTask PollSource(ITelemetrySource& source);
+
+    TelemetrySinks m_sinks;
+    std::vector<std::unique_ptr<ITelemetrySource>> m_sources;
+    std::string m_lastStatus;
+    std::atomic<uint64_t> m_throttledPolls{ 0 };
+    IngestExecutor m_executor;
+    std::jthread m_worker;
+  };
+
+  /**
+   * @brief Creates a source by name:
+   *        generator                  test data
+   *        udp     udp.bind, udp.port            see UdpTelemetryReceiver
+   *        shm     shm.name                      see SharedTelemetryReader
+   *        replay  replay.path, replay.speed, replay.lap   see SessionReplay
+   * @return The source, or nullptr for an unknown name.
+   */
+  [[nodiscard]] std::unique_ptr<ITelemetrySource> CreateTelemetrySource(std::string_view name, const Config& config);
+
+  /**
+   * @brief Creates the sources a configuration lists in "source", separated by commas, e.g. "udp, shm"; the generator
+   *        if it is not set. Unknown names are skipped.
+   */
+  [[nodiscard]] std::vector<std::unique_ptr<ITelemetrySource>> CreateTelemetrySources(const Config& config);
+} // namespace pacemaker
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Core/ITelemetrySource.h>
+#include <Testing/TestDataGenerator.h>
+
+namespace pacemaker
+{
+  /**
+   * @brief Publishes the test data generator's output at sim rate; the default source when no live data is configured.
+   */
+  class TestDataSource : public ITelemetrySource
+  {
+  public:
+    [[nodiscard]] const char* GetName() const override { return "generator"; }
+    [[nodiscard]] SourceMode GetMode() const override { return SourceMode::Polling; }
+
+    bool Open(TelemetrySinks& sinks) override;
+    void Poll(std::chrono::steady_clock::duration elapsed) override;
+    void Close() override;
+    [[nodiscard]] std::string GetStatus() const override;
+
+  private:
+    TestDataGenerator m_generator;
+    TelemetrySinks* m_sinks = nullptr;
+    double m_time = 0.0;  // Simulated seconds
+    uint64_t m_ticks = 0;
+  };
+} // namespace pacemaker
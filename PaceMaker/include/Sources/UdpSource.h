@@ -0,0 +1,29 @@
+#pragma once
+
+#include <Core/ITelemetrySource.h>
+#include <DataReader/UdpTelemetryReceiver.h>
+
+namespace pacemaker
+{
+  /**
+   * @brief Publishes telemetry received over UDP (see DataReader/UdpTelemetryReceiver.h).
+   *        A network feed cannot be held back; values the render thread cannot take in time are dropped by the brokers.
+   */
+  class UdpSource : public ITelemetrySource
+  {
+  public:
+    explicit UdpSource(const UdpTelemetryReceiver::Options& options);
+
+    [[nodiscard]] const char* GetName() const override { return "udp"; }
+    [[nodiscard]] SourceMode GetMode() const override { return SourceMode::Async; }
+
+    bool Open(TelemetrySinks& sinks) override;
+    [[nodiscard]] IngestTask Ingest(IngestExecutor& executor) override;
+    void Close() override;
+    [[nodiscard]] std::string GetStatus() const override;
+
+  private:
+    UdpTelemetryReceiver::Options m_options;
+    UdpTelemetryReceiver m_receiver;
+  };
+} // namespace pacemaker
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <Data/DataStructs.h>
-#include <Overlays/TireInfoOverlay.h>
+#include <Data/LeaderboardDelta.h>
+#include <Data/RelativeTimingEngine.h>
+
+#include <vector>
 
 namespace pacemaker
 {
@@ -9,7 +12,11 @@ namespace pacemaker
 class TestDataGenerator
 {
 public:
-  TestDataGenerator();
+  static constexpr int DEFAULT_CAR_COUNT = 8;   // The hand-written field
+  static constexpr int MAX_CAR_COUNT = 200;
+
+  // carCount beyond the hand-written field adds generated cars, whose gaps move every update
+  explicit TestDataGenerator(int carCount = DEFAULT_CAR_COUNT);
   ~TestDataGenerator() = default;
 
   // Update methods - call these with deltaTime in your game loop
@@ -21,21 +28,33 @@ public:
 
   // Getters for data
   const LeaderboardData& GetLeaderboardData() const { return m_leaderboardData; }
+  const LeaderboardDelta& GetLeaderboardDelta() const { return m_leaderboardDelta; } // Changes made by the last UpdateLeaderboardData()
   const RelativeTimingData& GetRelativeTimingData() const { return m_relativeTimingData; }
   const TireInfoData& GetTireData() const { return m_tireData; }
   const VehicleData& GetVehicleData() const { return m_vehicleData; }
   const InputTelemetryData& GetInputTelemetryData() const { return m_inputTelemetryData; }
 
 private:
-  void InitializeLeaderboardData();
+  void InitializeLeaderboardData(int carCount);
   void InitializeRelativeTimingData();
   void InitializeTireData();
   void InitializeVehicleData();
   void InitializeInputTelemetryData();
 
 private:
+  static constexpr TimeMs LAP_TIME = 90000;          // Simulated lap length; every lap takes exactly this long
+  static constexpr TimeMs INITIAL_LAP_TIME = 88710;  // Lap time on the first tick, so the first lap ends shortly after start
+  static constexpr float TRACK_LENGTH = 5000.0f;     // Meters; with LAP_TIME about 200 km/h
+  static constexpr int PLAYER_NUMBER = 11;            // The player's car, or the last car if the field has no such number
+  static constexpr int FIRST_GENERATED_NUMBER = 100;  // Car numbers of generated cars start here, clear of the hand-written ones
+
   LeaderboardData m_leaderboardData;
+  LeaderboardDelta m_leaderboardDelta;
   RelativeTimingData m_relativeTimingData;
+  RelativeTimingEngine m_relativeTiming{ TRACK_LENGTH };
+  std::vector<CarTrackState> m_trackStates;  // One per leaderboard row
+  std::vector<float> m_startDistances;       // Lap fraction per car at time 0
+  size_t m_playerIndex = 0;                  // Player's car in m_trackStates
   TireInfoData m_tireData;
   VehicleData m_vehicleData;
   InputTelemetryData m_inputTelemetryData;
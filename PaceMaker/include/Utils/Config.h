@@ -0,0 +1,43 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
+namespace pacemaker
+{
+  /**
+   * @brief Settings read from a plain-text file of "key = value" lines; '#' starts a comment.
+   *        Keys are grouped by dotted prefixes, e.g.:
+   *        source = udp
+   *        udp.port = 20790
+   *        Values set later, e.g. from the command line, override those loaded.
+   */
+  class Config
+  {
+  public:
+    /**
+     * @brief Loads settings from a file, adding to or overriding those already set.
+     * @return false if the file does not exist or cannot be read; the settings are unchanged then.
+     */
+    bool Load(const std::filesystem::path& path);
+
+    void Set(std::string_view key, std::string_view value);
+
+    [[nodiscard]] bool Contains(std::string_view key) const;
+
+    /** @brief Gets a value, or the fallback if the key is not set. */
+    [[nodiscard]] std::string GetString(std::string_view key, std::string_view fallback) const;
+
+    /** @brief Gets a value as an integer, or the fallback if the key is not set or not a number. */
+    [[nodiscard]] int GetInt(std::string_view key, int fallback) const;
+
+    /** @brief Gets a value as a number, or the fallback if the key is not set or not a number. */
+    [[nodiscard]] double GetDouble(std::string_view key, double fallback) const;
+
+  private:
+    std::map<std::string, std::string, std::less<>> m_values;
+  };
+} // namespace pacemaker
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace pacemaker
+{
+
+template<typename Signature, size_t Capacity = 4 * sizeof(void*)>
+class Delegate;
+
+/**
+* Delegate class template, a move-only callable wrapper that never allocates.
+* The callable is stored inline in a small fixed buffer; anything larger than Capacity is rejected at compile time,
+* so wrapping a lambda that captures `this` plus a few references costs no heap traffic, unlike std::function.
+*/
+template<typename R, typename... Args, size_t Capacity>
+class Delegate<R(Args...), Capacity>
+{
+public:
+  /**
+   * @brief Constructs an empty delegate
+   */
+  Delegate() noexcept = default;
+
+  /**
+   * @brief Constructs a delegate holding the given callable inline
+   * @param callable Any callable invocable as R(Args...) that fits into Capacity bytes
+   */
+  template<typename F>
+    requires (!std::is_same_v<std::remove_cvref_t<F>, Delegate> && std::is_invocable_r_v<R, F&, Args...>)
+  Delegate(F&& callable) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F&&>) {
+    using Callable = std::decay_t<F>;
+    static_assert(sizeof(Callable) <= Capacity, "Callable is too large for the delegate's inline storage");
+    static_assert(alignof(Callable) <= alignof(std::max_align_t), "Callable is over-aligned for the delegate's inline storage");
+    static_assert(std::is_nothrow_move_constructible_v<Callable>, "Callable must be nothrow move constructible");
+
+    ::new (static_cast<void*>(m_storage)) Callable(std::forward<F>(callable));
+    m_invoke = [](void* storage, Args... args) -> R {
+      return (*std::launder(static_cast<Callable*>(storage)))(std::forward<Args>(args)...);
+    };
+    m_manage = [](void* destination, void* source) noexcept {
+      auto* callable = std::launder(static_cast<Callable*>(source));
+      if (destination)
+      {
+        ::new (destination) Callable(std::move(*callable));
+      }
+      callable->~Callable();
+    };
+  }
+
+  Delegate(Delegate&& other) noexcept { MoveFrom(other); }
+
+  Delegate& operator=(Delegate&& other) noexcept {
+    if (this != &other)
+    {
+      Reset();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  Delegate(const Delegate&) = delete;
+  Delegate& operator=(const Delegate&) = delete;
+
+  ~Delegate() { Reset(); }
+
+  /**
+   * @brief Invokes the stored callable. Calling an empty delegate is undefined.
+   */
+  R operator()(Args... args) const {
+    return m_invoke(m_storage, std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Checks if a callable is stored
+   */
+  [[nodiscard]] explicit operator bool() const noexcept { return m_invoke != nullptr; }
+
+  /**
+   * @brief Destroys the stored callable, leaving the delegate empty
+   */
+  void Reset() noexcept {
+    if (m_manage)
+    {
+      m_manage(nullptr, m_storage);
+    }
+    m_invoke = nullptr;
+    m_manage = nullptr;
+  }
+
+private:
+  void MoveFrom(Delegate& other) noexcept {
+    if (other.m_manage)
+    {
+      other.m_manage(m_storage, other.m_storage);
+    }
+    m_invoke = std::exchange(other.m_invoke, nullptr);
+    m_manage = std::exchange(other.m_manage, nullptr);
+  }
+
+  using InvokeFn = R(*)(void*, Args...);
+  using ManageFn = void(*)(void*, void*) noexcept; // Move-constructs into the first argument (if any), destroys the second
+
+  alignas(std::max_align_t) mutable std::byte m_storage[Capacity]{}; // Inline callable storage
+  InvokeFn m_invoke{ nullptr }; // Type-erased call thunk
+  ManageFn m_manage{ nullptr }; // Type-erased move/destroy thunk
+};
+} // namespace pacemaker
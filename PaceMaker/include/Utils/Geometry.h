@@ -32,6 +32,11 @@ struct Bounds
 		return px >= (x + width - handleSize) && px <= (x + width) &&
 			py >= (y + height - handleSize) && py <= (y + height);
 	}
+
+	/**
+	 * @brief Compares position and size with another Bounds.
+	 */
+	[[nodiscard]] constexpr bool operator==(const Bounds&) const noexcept = default;
 };
 
 /**
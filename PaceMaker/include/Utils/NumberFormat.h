@@ -0,0 +1,28 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+
+namespace pacemaker
+{
+  /**
+   * @brief Formats an integer with std::to_chars, e.g. "7", or "83%" with the suffix "%".
+   *        Unlike snprintf() there is no format string to parse and no locale to consult.
+   * @param buffer Destination buffer, always null-terminated; left empty if the text does not fit.
+   * @param value The value.
+   * @param suffix Text appended to the number.
+   * @return The text written, without the terminator.
+   */
+  std::string_view FormatInteger(std::span<char> buffer, long long value, std::string_view suffix = {});
+
+  /**
+   * @brief Formats a number with a fixed number of decimals with std::to_chars, e.g. "92.4" for 1 decimal.
+   *        Rounds like snprintf("%.*f").
+   * @param buffer Destination buffer, always null-terminated; left empty if the text does not fit.
+   * @param value The value.
+   * @param decimals Number of decimals, 0 for none.
+   * @param suffix Text appended to the number.
+   * @return The text written, without the terminator.
+   */
+  std::string_view FormatFixed(std::span<char> buffer, double value, int decimals, std::string_view suffix = {});
+} // namespace pacemaker
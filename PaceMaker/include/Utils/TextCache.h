@@ -0,0 +1,151 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+struct Font;
+struct Vector2;
+struct Color;
+
+namespace pacemaker
+{
+  /**
+   * @brief Cache of laid out labels, keyed by font, size, spacing and text. The first use of a label measures it and
+   *        builds its glyph quads (atlas and screen rectangles, as DrawTextEx() places them); later uses skip the UTF-8
+   *        decoding, glyph lookups and per-glyph draw calls and submit the quads to raylib's batch in one go.
+   *        Labels not drawn for EVICT_AFTER_FRAMES frames are dropped, so changing numbers do not pile up.
+   *        Render thread only. Draws single-line text.
+   *        E.g.:
+   *        TextCache::Instance().BeginFrame();                                   // Once per frame
+   *        const Vector2 size = TextCache::Instance().Measure(font, text, 18, 1);
+   *        TextCache::Instance().Draw(font, text, { x - size.x / 2, y }, 18, 1, WHITE);
+   */
+  class TextCache
+  {
+  public:
+    static constexpr uint64_t EVICT_AFTER_FRAMES = 300; // A few seconds unused
+
+    // Lookups of a frame
+    struct FrameStats
+    {
+      uint32_t lookups = 0; // Measure() and Draw() calls
+      uint32_t hits = 0;    // Calls that found the label laid out
+
+      /** @brief Gets the share of lookups that hit, 1 for a frame without any. */
+      [[nodiscard]] float GetHitRate() const noexcept { return lookups > 0 ? (float)hits / (float)lookups : 1.0f; }
+    };
+
+    /**
+     * @brief Gets the singleton instance of the TextCache.
+     * @return Reference to the TextCache instance.
+     */
+    static TextCache& Instance();
+
+    /**
+     * @brief Starts a frame: keeps the finished frame's counters for GetLastFrameStats() and drops stale labels.
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Measures a label like MeasureTextEx().
+     */
+    [[nodiscard]] Vector2 Measure(const Font& font, std::string_view text, float fontSize, float spacing);
+
+    /**
+     * @brief Draws a label like DrawTextEx().
+     */
+    void Draw(const Font& font, std::string_view text, Vector2 position, float fontSize, float spacing, Color tint);
+
+    /** @brief Gets the lookups of the last finished frame. */
+    [[nodiscard]] const FrameStats& GetLastFrameStats() const noexcept { return m_lastFrame; }
+
+    /** @brief Gets the lookups since the program started. */
+    [[nodiscard]] uint64_t GetTotalLookups() const noexcept { return m_totalLookups; }
+    [[nodiscard]] uint64_t GetTotalHits() const noexcept { return m_totalHits; }
+
+    /** @brief Gets the number of labels cached. */
+    [[nodiscard]] size_t Size() const noexcept { return m_entries.size(); }
+
+    /** @brief Drops all labels, e.g. when a font is reloaded. */
+    void Clear() { m_entries.clear(); }
+
+  private:
+    // A glyph's rectangle on screen, relative to the label's position, and in the font atlas, in texture coordinates
+    struct GlyphQuad
+    {
+      float left, top, right, bottom;
+      float u0, v0, u1, v1;
+    };
+
+    struct Entry
+    {
+      float width = 0.0f;           // Extents as MeasureTextEx() gives them
+      float height = 0.0f;
+      unsigned int textureId = 0;   // Atlas the quads sample
+      std::vector<GlyphQuad> quads;
+      uint64_t lastUsedFrame = 0;
+    };
+
+    struct Key
+    {
+      unsigned int fontId;
+      float fontSize;
+      float spacing;
+      std::string text;
+    };
+
+    // Key to look up with, without copying the text
+    struct KeyView
+    {
+      unsigned int fontId;
+      float fontSize;
+      float spacing;
+      std::string_view text;
+    };
+
+    struct KeyHash
+    {
+      using is_transparent = void;
+      size_t operator()(const KeyView& key) const noexcept;
+      size_t operator()(const Key& key) const noexcept { return (*this)(KeyView{ key.fontId, key.fontSize, key.spacing, key.text }); }
+    };
+
+    struct KeyEqual
+    {
+      using is_transparent = void;
+      static KeyView View(const Key& key) noexcept { return { key.fontId, key.fontSize, key.spacing, key.text }; }
+      static const KeyView& View(const KeyView& key) noexcept { return key; }
+
+      template<typename A, typename B>
+      bool operator()(const A& a, const B& b) const noexcept
+      {
+        const KeyView& left = View(a);
+        const KeyView& right = View(b);
+        return left.fontId == right.fontId && left.fontSize == right.fontSize && left.spacing == right.spacing
+          && left.text == right.text;
+      }
+    };
+
+    TextCache() = default;
+    ~TextCache() = default;
+    TextCache(const TextCache&) = delete;
+    TextCache& operator=(const TextCache&) = delete;
+
+    /** @brief Finds a label, laying it out on a miss. */
+    const Entry& Find(const Font& font, std::string_view text, float fontSize, float spacing);
+
+    /** @brief Measures a label and builds its glyph quads the way DrawTextEx() places the glyphs. */
+    static void Layout(const Font& font, std::string_view text, float fontSize, float spacing, Entry& entry);
+
+    std::unordered_map<Key, Entry, KeyHash, KeyEqual> m_entries;
+    uint64_t m_frame = 0;          // Frames begun
+    FrameStats m_frameStats;       // Lookups of the current frame
+    FrameStats m_lastFrame;        // Lookups of the last finished frame
+    uint64_t m_totalLookups = 0;
+    uint64_t m_totalHits = 0;
+  };
+} // namespace pacemaker
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Data/DataStructs.h>
+
+#include <cstddef>
+
+namespace pacemaker
+{
+  /**
+   * @brief Formats a lap time as "m:ss.mmm", e.g. "2:06.358", or "-" if the time is not set.
+   * @param buffer Destination buffer, always null-terminated; left empty if the text does not fit.
+   * @param size Size of the buffer in bytes.
+   * @param time The lap time.
+   */
+  void FormatLapTime(char* buffer, size_t size, TimeMs time);
+
+  /**
+   * @brief Formats a signed gap in seconds, e.g. "+1.7" or "-18.8", or "0.0" if it rounds to zero.
+   *        An unset gap formats as an empty string.
+   * @param buffer Destination buffer, always null-terminated; left empty if the text does not fit.
+   * @param size Size of the buffer in bytes.
+   * @param gap The gap.
+   * @param decimals Number of decimals to show, 1 to 3.
+   */
+  void FormatGap(char* buffer, size_t size, TimeMs gap, int decimals);
+
+  /**
+   * @brief Formats a session clock as "h:mm:ss", e.g. "1:09:45", or "-" if the time is not set.
+   * @param buffer Destination buffer, always null-terminated; left empty if the text does not fit.
+   * @param size Size of the buffer in bytes.
+   * @param time The session time.
+   */
+  void FormatSessionTime(char* buffer, size_t size, TimeMs time);
+} // namespace pacemaker
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+struct Color;
+
+namespace pacemaker
+{
+  /**
+   * @brief Line graph of up to MAX_TRACES traces over a scrolling window of samples, kept in a GPU vertex buffer.
+   *        Every sample adds one segment per trace to a ring of segment slots, as a thick-line quad whose corners a
+   *        vertex shader places from the two values and the slot's age. Pushing a sample rewrites only its slot and
+   *        scrolling is a uniform, so a frame uploads the few new slots and draws every trace in one draw call,
+   *        whatever the window's length.
+   *        GPU objects are created on first Draw(), on the render thread. Draw() returns false where they cannot be
+   *        (no shader support), so the caller can draw the traces itself.
+   *        E.g.:
+   *        TraceGraphBuffer graph(1200, 2);
+   *        graph.SetTrace(0, GREEN, 2.0f);
+   *        graph.Push(values);                                  // On each sample
+   *        const TraceGraphBuffer::TraceLayout layouts[] = { { bottom, -height }, { middle, -height / 2 } };
+   *        if (!graph.Draw(left, width / 1200.0f, layouts)) DrawTracesOnCpu();
+   */
+  class TraceGraphBuffer
+  {
+  public:
+    static constexpr size_t MAX_TRACES = 4;
+
+    // Where a trace is drawn: its point for a value v is at y = baseline + v * scale
+    struct TraceLayout
+    {
+      float baseline; // Screen y of the value 0
+      float scale;    // Pixels per unit of value, negative to draw larger values higher
+    };
+
+    /**
+     * @param capacity Samples in the window, at least 2.
+     * @param traceCount Values per sample, 1 to MAX_TRACES.
+     */
+    TraceGraphBuffer(size_t capacity, size_t traceCount);
+    ~TraceGraphBuffer();
+
+    TraceGraphBuffer(const TraceGraphBuffer&) = delete;
+    TraceGraphBuffer& operator=(const TraceGraphBuffer&) = delete;
+
+    /** @brief Appends a sample, dropping the oldest once the window is full. */
+    void Push(std::span<const float> values);
+
+    /** @brief Empties the window. */
+    void Clear();
+
+    /**
+     * @brief Changes the number of samples in the window and empties it. Frees the GPU objects, so call it on the
+     *        render thread.
+     */
+    void SetCapacity(size_t capacity);
+
+    [[nodiscard]] size_t GetCapacity() const noexcept { return m_capacity; }
+
+    /** @brief Gets the number of samples in the window. */
+    [[nodiscard]] size_t Size() const noexcept
+    {
+      return m_count < m_capacity ? static_cast<size_t>(m_count) : m_capacity;
+    }
+
+    /**
+     * @brief Sets the look of a trace.
+     * @param trace Index of the value in the samples.
+     * @param color Line color.
+     * @param thickness Line thickness in pixels.
+     */
+    void SetTrace(size_t trace, const Color& color, float thickness);
+
+    /**
+     * @brief Uploads the slots written since the last draw and draws all traces in one call.
+     *        The oldest sample is at x = left, each newer one step pixels to the right.
+     * @param layouts Where each trace goes, by trace index; traces without one are not drawn.
+     * @return false if the GPU objects are not available; nothing was drawn.
+     */
+    bool Draw(float left, float step, std::span<const TraceLayout> layouts) const;
+
+    /** @brief Frees the GPU objects; the next Draw() recreates them. Call before the window is closed. */
+    void Release();
+
+  private:
+    // One corner of a segment's quad
+    struct Vertex
+    {
+      float slot;   // Slot of the segment, its age follows from the oldest slot
+      float from;   // Value of the previous sample
+      float to;     // Value of this sample
+      float corner; // Bit 0: end of the segment, bit 1: side of the line, plus 4 x the trace
+    };
+
+    static constexpr size_t VERTICES_PER_SEGMENT = 6; // Two triangles
+
+    struct TraceStyle
+    {
+      float color[4];
+      float thickness;
+    };
+
+    void WriteSlot(size_t slot, std::span<const float> values);
+    bool CreateGpuObjects() const;
+    void Upload() const;
+
+    size_t m_capacity;
+    size_t m_traceCount;
+    uint64_t m_count = 0;                // Samples pushed since the last Clear()
+    std::vector<float> m_lastValues;     // Values of the newest sample, where the next segments start
+    std::vector<Vertex> m_vertices;      // CPU copy of the vertex buffer, slot by slot
+    TraceStyle m_styles[MAX_TRACES]{};
+
+    mutable size_t m_dirtyCount = 0;     // Newest slots written since the last upload
+    mutable bool m_hasGpuObjects = false;
+    mutable bool m_hasGpuFailed = false; // Creation failed once; not retried
+    mutable unsigned int m_shader = 0;
+    mutable unsigned int m_vertexArray = 0;
+    mutable unsigned int m_vertexBuffer = 0;
+    mutable int m_mvpLocation = -1;
+    mutable int m_graphLocation = -1;
+    mutable int m_colorsLocation = -1;
+    mutable int m_layoutsLocation = -1;
+  };
+} // namespace pacemaker
@@ -1,6 +1,7 @@
 #include <Core/Widgets/BaseWidget.h>
 
 #include <raylib.h>
+#include <rlgl.h>
 
 namespace pacemaker
 {
@@ -9,6 +10,86 @@ BaseWidget::BaseWidget(std::string_view name, Bounds bounds, MinSize minSize)
 	: m_bounds(bounds), m_minSize(minSize), m_name(name) {
 }
 //------------------------------------------------------------------------------
+BaseWidget::~BaseWidget() = default;
+//------------------------------------------------------------------------------
+void BaseWidget::RenderTextureDeleter::operator()(RenderTexture* texture) const {
+	UnloadRenderTexture(*texture);
+	delete texture;
+}
+//------------------------------------------------------------------------------
+void BaseWidget::Render() const {
+	if (!m_isVisible)
+		return;
+
+	if (!m_isCacheEnabled || !RedrawRenderCache())
+	{
+		RenderContent();
+		return;
+	}
+
+	// The cache holds premultiplied colors, see RedrawRenderCache(); render textures are stored bottom-up
+	const Bounds content = GetContentBounds();
+	const Texture2D& texture = m_renderCache->texture;
+	BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+	DrawTextureRec(texture, { 0.0f, 0.0f, (float)texture.width, -(float)texture.height },
+		{ (float)content.x, (float)content.y }, WHITE);
+	EndBlendMode();
+}
+//------------------------------------------------------------------------------
+bool BaseWidget::RedrawRenderCache() const {
+	const Bounds content = GetContentBounds();
+	if (m_renderCache &&
+		(m_renderCache->texture.width != content.width || m_renderCache->texture.height != content.height))
+		m_renderCache.reset();
+
+	if (!m_renderCache)
+	{
+		if (content.width <= 0 || content.height <= 0)
+			return false;
+
+		const RenderTexture2D texture = LoadRenderTexture(content.width, content.height);
+		if (texture.id == 0)
+			return false;
+
+		m_renderCache.reset(new RenderTexture(texture));
+		m_isCacheValid = false;
+	}
+
+	// A resize redraws even if the content bounds keep their size, e.g. when clamped to a minimum
+	if (m_cachedWidth != m_bounds.width || m_cachedHeight != m_bounds.height)
+		m_isCacheValid = false;
+
+	if (m_isCacheValid)
+		return true;
+
+	// Draw as on screen, shifted to the texture's origin. Blending the alpha channel with ONE instead of SRC_ALPHA
+	// keeps translucent backgrounds as opaque as they are on screen, leaving the colors premultiplied by it.
+	Camera2D camera{};
+	camera.target = { (float)content.x, (float)content.y };
+	camera.zoom = 1.0f;
+
+	BeginTextureMode(*m_renderCache);
+	ClearBackground(BLANK);
+	BeginMode2D(camera);
+	rlSetBlendFactorsSeparate(
+		RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+	BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+	RenderContent();
+	EndBlendMode();
+	EndMode2D();
+	EndTextureMode();
+
+	m_isCacheValid = true;
+	m_cachedWidth = m_bounds.width;
+	m_cachedHeight = m_bounds.height;
+	return true;
+}
+//------------------------------------------------------------------------------
+void BaseWidget::ReleaseGraphicsResources() {
+	m_renderCache.reset();
+	m_isCacheValid = false;
+}
+//------------------------------------------------------------------------------
 void BaseWidget::OnMousePressed(int x, int y) {
 	if (m_bounds.ContainsResizeHandle(x, y) && !m_isDragging && !m_isResizing)
 	{
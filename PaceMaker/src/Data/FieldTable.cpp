@@ -0,0 +1,236 @@
+#include <Data/FieldTable.h>
+#include <Data/LeaderboardDelta.h>
+
+#include <algorithm>
+#include <numeric>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define PACEMAKER_FIELD_TABLE_SSE2 1
+#endif
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+void FieldTable::Resize(size_t size)
+{
+  m_positions.resize(size);
+  m_numbers.resize(size);
+  m_names.resize(size);
+  m_teamCodes.resize(size);
+  m_currentTimes.resize(size);
+  m_bestTimes.resize(size);
+  m_gaps.resize(size);
+  m_teamColorIndices.resize(size);
+  m_batteryPercents.resize(size);
+  m_pitFlags.resize(size);
+}
+
+//------------------------------------------------------------------------------
+void FieldTable::Assign(std::span<const PlayerData> players)
+{
+  Resize(players.size());
+  for (size_t i = 0; i < players.size(); ++i)
+  {
+    const auto& player = players[i];
+    m_positions[i] = player.position;
+    m_numbers[i] = player.number;
+    m_names[i] = player.name;
+    m_teamCodes[i] = EMPTY_STRING_ID;
+    m_currentTimes[i] = player.currentTime;
+    m_bestTimes[i] = player.bestTime;
+    m_gaps[i] = player.gap;
+    m_teamColorIndices[i] = player.teamColorIndex;
+    m_batteryPercents[i] = player.batteryPercent;
+    m_pitFlags[i] = player.inPit ? 1 : 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+void FieldTable::Assign(std::span<const RelativePlayerData> players)
+{
+  Resize(players.size());
+  for (size_t i = 0; i < players.size(); ++i)
+  {
+    const auto& player = players[i];
+    m_positions[i] = player.position;
+    m_numbers[i] = player.number;
+    m_names[i] = player.name;
+    m_teamCodes[i] = player.teamCode;
+    m_currentTimes[i] = NO_TIME;
+    m_bestTimes[i] = NO_TIME;
+    m_gaps[i] = player.gap;
+    m_teamColorIndices[i] = player.teamColorIndex;
+    m_batteryPercents[i] = 0;
+    m_pitFlags[i] = 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+void FieldTable::Update(std::span<const PlayerData> players, const DirtyRowSet& dirtyRows)
+{
+  if (players.size() != Size())
+  {
+    Assign(players);
+    return;
+  }
+
+  for (size_t i = 0; i < players.size(); ++i)
+  {
+    if (!dirtyRows.IsDirty(i))
+    {
+      continue;
+    }
+
+    const auto& player = players[i];
+    m_positions[i] = player.position;
+    m_numbers[i] = player.number;
+    m_names[i] = player.name;
+    m_currentTimes[i] = player.currentTime;
+    m_bestTimes[i] = player.bestTime;
+    m_gaps[i] = player.gap;
+    m_teamColorIndices[i] = player.teamColorIndex;
+    m_batteryPercents[i] = player.batteryPercent;
+    m_pitFlags[i] = player.inPit ? 1 : 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+template<typename Column>
+void FieldTable::Permute(std::vector<Column>& column)
+{
+  const size_t size = column.size();
+  m_scratch.resize(size * sizeof(Column));
+
+  auto* sorted = reinterpret_cast<Column*>(m_scratch.data());
+  for (size_t i = 0; i < size; ++i)
+  {
+    sorted[i] = column[m_order[i]];
+  }
+  std::memcpy(column.data(), sorted, size * sizeof(Column));
+}
+
+//------------------------------------------------------------------------------
+void FieldTable::SortByPosition()
+{
+  // Positions change a few at a time, so the common case is a single pass over one column
+  if (std::is_sorted(m_positions.begin(), m_positions.end()))
+  {
+    return;
+  }
+
+  // Positions are normally exactly 1..N, which places every row directly in one pass instead of comparison sorting
+  const size_t size = Size();
+  constexpr uint32_t UNPLACED = UINT32_MAX;
+  m_order.assign(size, UNPLACED);
+
+  bool isPermutation = true;
+  for (size_t i = 0; i < size && isPermutation; ++i)
+  {
+    const int32_t position = m_positions[i];
+    isPermutation = position >= 1 && static_cast<size_t>(position) <= size && m_order[position - 1] == UNPLACED;
+    if (isPermutation)
+    {
+      m_order[position - 1] = static_cast<uint32_t>(i);
+    }
+  }
+
+  if (!isPermutation)
+  {
+    std::iota(m_order.begin(), m_order.end(), 0u);
+    std::stable_sort(m_order.begin(), m_order.end(),
+      [this](uint32_t a, uint32_t b) { return m_positions[a] < m_positions[b]; });
+  }
+
+  Permute(m_positions);
+  Permute(m_numbers);
+  Permute(m_names);
+  Permute(m_teamCodes);
+  Permute(m_currentTimes);
+  Permute(m_bestTimes);
+  Permute(m_gaps);
+  Permute(m_teamColorIndices);
+  Permute(m_batteryPercents);
+  Permute(m_pitFlags);
+}
+
+//------------------------------------------------------------------------------
+size_t FieldTable::CountInPit() const noexcept
+{
+  const uint8_t* flags = m_pitFlags.data();
+  const size_t size = m_pitFlags.size();
+  size_t count = 0;
+  size_t i = 0;
+#ifdef PACEMAKER_FIELD_TABLE_SSE2
+  // Compilers at -O2 do not vectorize the widening sum; psadbw adds 16 flags at a time into two 64-bit lanes
+  __m128i sums = _mm_setzero_si128();
+  for (; i + 16 <= size; i += 16)
+  {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags + i));
+    sums = _mm_add_epi64(sums, _mm_sad_epu8(block, _mm_setzero_si128()));
+  }
+  count = static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+#endif
+  for (; i < size; ++i)
+  {
+    count += flags[i];
+  }
+  return count;
+}
+
+//------------------------------------------------------------------------------
+size_t FieldTable::IndexOfNumber(int number) const noexcept
+{
+  auto it = std::find(m_numbers.begin(), m_numbers.end(), number);
+  return static_cast<size_t>(it - m_numbers.begin());
+}
+
+//------------------------------------------------------------------------------
+TimeMs FieldTable::FastestBestTime() const noexcept
+{
+  // Reinterpreted as unsigned, NO_TIME (and any negative value) sorts above every real time, keeping the loop branch-free
+  const TimeMs* times = m_bestTimes.data();
+  const size_t size = m_bestTimes.size();
+  uint32_t fastest = UINT32_MAX;
+  size_t i = 0;
+#ifdef PACEMAKER_FIELD_TABLE_SSE2
+  // SSE2 has no unsigned 32-bit min, but flipping the sign bit maps unsigned order onto signed order for pcmpgtd
+  const __m128i signBit = _mm_set1_epi32(INT32_MIN);
+  __m128i lowest = _mm_set1_epi32(INT32_MAX); // UINT32_MAX with its sign bit flipped
+  for (; i + 4 <= size; i += 4)
+  {
+    const __m128i block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(times + i)), signBit);
+    const __m128i isLower = _mm_cmplt_epi32(block, lowest);
+    lowest = _mm_or_si128(_mm_and_si128(isLower, block), _mm_andnot_si128(isLower, lowest));
+  }
+  alignas(16) uint32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_xor_si128(lowest, signBit));
+  fastest = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+#endif
+  for (; i < size; ++i)
+  {
+    fastest = std::min(fastest, static_cast<uint32_t>(times[i]));
+  }
+  return fastest < static_cast<uint32_t>(NO_TIME) ? static_cast<TimeMs>(fastest) : NO_TIME;
+}
+
+//------------------------------------------------------------------------------
+FieldTable::RowView FieldTable::Row(size_t index) const noexcept
+{
+  return {
+    m_positions[index],
+    m_numbers[index],
+    m_names[index],
+    m_teamCodes[index],
+    m_currentTimes[index],
+    m_bestTimes[index],
+    m_gaps[index],
+    m_teamColorIndices[index],
+    m_batteryPercents[index],
+    m_pitFlags[index] != 0,
+  };
+}
+
+} // namespace pacemaker
@@ -0,0 +1,173 @@
+#include <Data/LapDeltaEngine.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+// First grid point of a sector; one past the last sector is the line at the end of the lap
+static size_t SectorStart(int sector)
+{
+  return static_cast<size_t>(sector) * LapDeltaEngine::GRID_POINTS / LapDeltaData::SECTOR_COUNT;
+}
+
+//------------------------------------------------------------------------------
+static TimeMs ToTime(float milliseconds)
+{
+  return static_cast<TimeMs>(std::lround(milliseconds));
+}
+
+//------------------------------------------------------------------------------
+LapDeltaEngine::LapDeltaEngine()
+  : m_bestLap(GRID_POINTS + 1, 0.0f)
+  , m_currentLap(GRID_POINTS + 1, 0.0f)
+{
+  Reset();
+}
+
+//------------------------------------------------------------------------------
+void LapDeltaEngine::Reset()
+{
+  m_nextPoint = 0;
+  m_isLapValid = false;
+  m_lastDistance = -1.0f;
+  m_lastTime = NO_TIME;
+  m_data = LapDeltaData{};
+  std::fill(std::begin(m_data.sectorDeltas), std::end(m_data.sectorDeltas), NO_TIME);
+}
+
+//------------------------------------------------------------------------------
+bool LapDeltaEngine::Update(float lapDistance, TimeMs lapTime, TimeMs lastLapTime)
+{
+  if (lapTime == NO_TIME || !(lapDistance >= 0.0f && lapDistance <= 1.0f))
+  {
+    return false;
+  }
+  lapDistance = std::min(lapDistance, std::nextafter(1.0f, 0.0f));
+
+  if (m_lastDistance < 0.0f)
+  {
+    // Joined mid-lap: nothing to compare this lap against, but the next one counts
+    m_isLapValid = false;
+  }
+  else if (lapDistance < m_lastDistance - 0.5f)
+  {
+    // Crossed the line; the sim's last lap time is exact, the samples either side of the line only bracket it
+    CompleteLap(lastLapTime != NO_TIME ? lastLapTime : m_lastTime + lapTime);
+    StartLap();
+  }
+  else if (lapTime < m_lastTime)
+  {
+    // Time went backwards without crossing the line, e.g. a replay seeking: the lap's samples no longer add up
+    m_isLapValid = false;
+  }
+
+  if (m_isLapValid && lapDistance >= m_lastDistance)
+  {
+    Record(lapDistance, lapTime);
+  }
+  if (lapDistance >= m_lastDistance || !m_isLapValid)
+  {
+    m_lastDistance = lapDistance;
+    m_lastTime = lapTime;
+  }
+
+  const LapDeltaData previous = m_data;
+  ComputeDelta(lapDistance, lapTime);
+  return !(m_data == previous);
+}
+
+//------------------------------------------------------------------------------
+void LapDeltaEngine::Record(float lapDistance, TimeMs lapTime)
+{
+  // Grid points passed since the previous sample, interpolated between the two samples; mostly none at input rate
+  const float span = lapDistance - m_lastDistance;
+  const float elapsed = static_cast<float>(lapTime - m_lastTime);
+  for (; m_nextPoint < GRID_POINTS; ++m_nextPoint)
+  {
+    const float point = static_cast<float>(m_nextPoint) / GRID_POINTS;
+    if (point > lapDistance)
+    {
+      break;
+    }
+    const float fraction = span > 0.0f ? (point - m_lastDistance) / span : 1.0f;
+    m_currentLap[m_nextPoint] = static_cast<float>(m_lastTime) + fraction * elapsed;
+  }
+}
+
+//------------------------------------------------------------------------------
+void LapDeltaEngine::CompleteLap(TimeMs lapTime)
+{
+  if (!m_isLapValid || lapTime < m_lastTime)
+  {
+    return;
+  }
+
+  Record(1.0f, lapTime);
+  m_currentLap[GRID_POINTS] = static_cast<float>(lapTime);
+  if (!HasBestLap() || lapTime < m_data.bestLapTime)
+  {
+    std::swap(m_bestLap, m_currentLap);
+    m_data.bestLapTime = lapTime;
+  }
+}
+
+//------------------------------------------------------------------------------
+void LapDeltaEngine::StartLap()
+{
+  m_isLapValid = true;
+  m_nextPoint = 0;
+  m_lastDistance = 0.0f;
+  m_lastTime = 0;
+}
+
+//------------------------------------------------------------------------------
+float LapDeltaEngine::BestTimeAt(float lapDistance) const noexcept
+{
+  const float position = lapDistance * GRID_POINTS;
+  const size_t point = std::min(static_cast<size_t>(position), GRID_POINTS - 1);
+  const float fraction = position - static_cast<float>(point);
+  return m_bestLap[point] + fraction * (m_bestLap[point + 1] - m_bestLap[point]);
+}
+
+//------------------------------------------------------------------------------
+void LapDeltaEngine::ComputeDelta(float lapDistance, TimeMs lapTime)
+{
+  m_data.sector = std::min(static_cast<int>(lapDistance * LapDeltaData::SECTOR_COUNT), LapDeltaData::SECTOR_COUNT - 1);
+  if (!HasBestLap())
+  {
+    return;
+  }
+
+  const float bestTime = BestTimeAt(lapDistance);
+  m_data.delta = lapTime - ToTime(bestTime);
+  m_data.predictedLapTime = m_data.bestLapTime + m_data.delta;
+
+  for (int sector = 0; sector < LapDeltaData::SECTOR_COUNT; ++sector)
+  {
+    TimeMs& sectorDelta = m_data.sectorDeltas[sector];
+    if (!m_isLapValid || sector > m_data.sector)
+    {
+      sectorDelta = NO_TIME;
+      continue;
+    }
+
+    const size_t start = SectorStart(sector);
+    const float bestStart = m_bestLap[start];
+    const float currentStart = m_currentLap[start];
+    if (sector < m_data.sector)
+    {
+      const size_t end = SectorStart(sector + 1);
+      sectorDelta = ToTime((m_currentLap[end] - currentStart) - (m_bestLap[end] - bestStart));
+    }
+    else
+    {
+      sectorDelta = ToTime((static_cast<float>(lapTime) - currentStart) - (bestTime - bestStart));
+    }
+  }
+}
+
+} // namespace pacemaker
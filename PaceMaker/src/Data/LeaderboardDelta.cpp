@@ -0,0 +1,235 @@
+#include <Data/LeaderboardDelta.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace pacemaker
+{
+
+namespace
+{
+  // Car numbers are indexed directly up to this bound; a leaderboard with larger or negative ones is scanned instead
+  constexpr int MAX_INDEXED_NUMBER = 4096;
+
+  // Building the index costs about as much as this many lookups by scanning, on 20 to 200 rows
+  constexpr size_t MIN_INDEXED_LOOKUPS = 16;
+
+  /**
+   * @brief Car number to row of one leaderboard, built once per ApplyDelta() so each swap and patch is a table lookup
+   *        rather than a scan of the rows. The table is reused per thread and never cleared: an entry only counts if
+   *        its row still holds the number, so building it writes one entry per row and steady-state ticks do not
+   *        allocate. Deltas with few lookups, leaderboards with repeated car numbers, where a lookup must find the first
+   *        of the rows as they are swapped, and leaderboards with numbers outside the table are scanned as before.
+   */
+  class RowIndex
+  {
+  public:
+    RowIndex(std::vector<PlayerData>& players, size_t lookups)
+      : m_players(players)
+    {
+      const auto isIndexable = [](const PlayerData& player) {
+        return player.number >= 0 && player.number < MAX_INDEXED_NUMBER;
+      };
+      if (lookups < MIN_INDEXED_LOOKUPS || !std::all_of(players.begin(), players.end(), isIndexable))
+      {
+        return;
+      }
+
+      auto& rows = ThreadRows();
+      for (size_t row = 0; row < players.size(); ++row)
+      {
+        const auto number = static_cast<size_t>(players[row].number);
+        if (number >= rows.size())
+        {
+          rows.resize(number + 1, 0);
+        }
+        if (rows[number] != row && HoldsNumber(rows[number], players[row].number))
+        {
+          return;
+        }
+        rows[number] = row;
+      }
+      m_rows = &rows;
+    }
+
+    /** @brief Gets the row of a car number, the first one if several rows have it; nullptr if none has. */
+    [[nodiscard]] PlayerData* Find(int number) const
+    {
+      if (!m_rows)
+      {
+        auto it = std::find_if(m_players.begin(), m_players.end(),
+          [number](const PlayerData& player) { return player.number == number; });
+        return it != m_players.end() ? &*it : nullptr;
+      }
+
+      const auto slot = static_cast<size_t>(number);
+      const auto& rows = *m_rows;
+      return number >= 0 && slot < rows.size() && HoldsNumber(rows[slot], number) ? &m_players[rows[slot]] : nullptr;
+    }
+
+    /** @brief Exchanges two rows, keeping the index in step. */
+    void Swap(PlayerData& a, PlayerData& b) const
+    {
+      std::swap(a, b);
+      if (m_rows)
+      {
+        std::swap((*m_rows)[static_cast<size_t>(a.number)], (*m_rows)[static_cast<size_t>(b.number)]);
+      }
+    }
+
+  private:
+    static std::vector<size_t>& ThreadRows()
+    {
+      static thread_local std::vector<size_t> rows;
+      return rows;
+    }
+
+    [[nodiscard]] bool HoldsNumber(size_t row, int number) const noexcept
+    {
+      return row < m_players.size() && m_players[row].number == number;
+    }
+
+    std::vector<PlayerData>& m_players;
+    std::vector<size_t>* m_rows = nullptr; // Row by car number, shared by the thread's indexes; null when scanning
+  };
+} // namespace
+
+//------------------------------------------------------------------------------
+template<typename Value>
+static bool AssignIfChanged(Value& target, const Value& value)
+{
+  if (target == value)
+  {
+    return false;
+  }
+  target = value;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+static bool ApplyPatch(PlayerData& row, const RowPatch& patch)
+{
+  const auto& values = patch.values;
+  bool changed = false;
+
+  if (patch.fields & ROW_FIELD_NAME)         changed |= AssignIfChanged(row.name, values.name);
+  if (patch.fields & ROW_FIELD_CURRENT_TIME) changed |= AssignIfChanged(row.currentTime, values.currentTime);
+  if (patch.fields & ROW_FIELD_BEST_TIME)    changed |= AssignIfChanged(row.bestTime, values.bestTime);
+  if (patch.fields & ROW_FIELD_GAP)          changed |= AssignIfChanged(row.gap, values.gap);
+  if (patch.fields & ROW_FIELD_TEAM_COLOR)   changed |= AssignIfChanged(row.teamColorIndex, values.teamColorIndex);
+  if (patch.fields & ROW_FIELD_BATTERY)      changed |= AssignIfChanged(row.batteryPercent, values.batteryPercent);
+  if (patch.fields & ROW_FIELD_IN_PIT)       changed |= AssignIfChanged(row.inPit, values.inPit);
+
+  return changed;
+}
+
+//------------------------------------------------------------------------------
+bool ApplyDelta(LeaderboardData& data, const LeaderboardDelta& delta, uint64_t revision)
+{
+  bool changed = false;
+
+  if (delta.sessionType) changed |= AssignIfChanged(data.sessionType, *delta.sessionType);
+  if (delta.sessionTime) changed |= AssignIfChanged(data.sessionTime, *delta.sessionTime);
+
+  if (!delta.swaps.empty() || !delta.patches.empty())
+  {
+    RowIndex rows(data.players, 2 * delta.swaps.size() + delta.patches.size());
+    for (const auto& swap : delta.swaps)
+    {
+      PlayerData* a = rows.Find(swap.numberA);
+      PlayerData* b = rows.Find(swap.numberB);
+      if (!a || !b || a == b)
+      {
+        continue;
+      }
+
+      // Rows stay sorted by position: exchange the rows, then give each its new place's position back
+      rows.Swap(*a, *b);
+      std::swap(a->position, b->position);
+      a->revision = revision;
+      b->revision = revision;
+      changed = true;
+    }
+
+    for (const auto& patch : delta.patches)
+    {
+      PlayerData* row = rows.Find(patch.number);
+      if (row && ApplyPatch(*row, patch))
+      {
+        row->revision = revision;
+        changed = true;
+      }
+    }
+  }
+
+  if (!changed)
+  {
+    return false;
+  }
+
+  // The first delta on top of a whole update stamps every row, so a consumer that missed the whole update still
+  // sees all rows as changed rather than only the patched ones
+  if (data.revision == 0)
+  {
+    for (auto& player : data.players)
+    {
+      player.revision = revision;
+    }
+  }
+
+  data.revision = revision;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void DirtyRowSet::Collect(const LeaderboardData& data, uint64_t sinceRevision, size_t previousRowCount)
+{
+  const size_t rowCount = data.players.size();
+  if (rowCount != previousRowCount || data.revision == 0 || data.revision < sinceRevision)
+  {
+    MarkAll(rowCount);
+    return;
+  }
+
+  Reset(rowCount);
+  for (size_t row = 0; row < rowCount; ++row)
+  {
+    if (data.players[row].revision > sinceRevision)
+    {
+      Mark(row);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void DirtyRowSet::MarkAll(size_t rowCount)
+{
+  Reset(rowCount);
+  for (size_t row = 0; row < rowCount; ++row)
+  {
+    Mark(row);
+  }
+}
+
+//------------------------------------------------------------------------------
+void DirtyRowSet::Reset(size_t rowCount)
+{
+  m_rowCount = rowCount;
+  m_dirtyCount = 0;
+  m_words.assign((rowCount + WORD_BITS - 1) / WORD_BITS, 0);
+}
+
+//------------------------------------------------------------------------------
+void DirtyRowSet::Mark(size_t row) noexcept
+{
+  uint64_t& word = m_words[row / WORD_BITS];
+  const uint64_t bit = uint64_t{ 1 } << (row % WORD_BITS);
+  if ((word & bit) == 0)
+  {
+    word |= bit;
+    ++m_dirtyCount;
+  }
+}
+
+} // namespace pacemaker
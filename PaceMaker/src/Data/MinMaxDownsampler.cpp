@@ -0,0 +1,83 @@
+#include <Data/MinMaxDownsampler.h>
+
+#include <algorithm>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+size_t MinMaxDownsampler::BucketSizeFor(size_t sampleCount, size_t columns) noexcept
+{
+  columns = std::max<size_t>(columns, 1);
+  return std::max<size_t>((sampleCount + columns - 1) / columns, 1);
+}
+
+//------------------------------------------------------------------------------
+MinMaxDownsampler::MinMaxDownsampler(size_t channelCount)
+  : m_channelCount(channelCount)
+  , m_minimums(channelCount, 0.0f)
+  , m_maximums(channelCount, 0.0f)
+  , m_isMaximumLast(channelCount, 0)
+  , m_points(channelCount * MAX_POINTS_PER_BUCKET, 0.0f)
+{
+}
+
+//------------------------------------------------------------------------------
+void MinMaxDownsampler::Reset(size_t bucketSize, uint64_t nextSample) noexcept
+{
+  m_bucketSize = std::max<size_t>(bucketSize, 1);
+  m_nextSample = nextSample;
+  m_bucketStart = nextSample;
+}
+
+//------------------------------------------------------------------------------
+size_t MinMaxDownsampler::Push(std::span<const float> values) noexcept
+{
+  const size_t count = std::min(values.size(), m_channelCount);
+  if (m_nextSample == m_bucketStart)
+  {
+    std::copy_n(values.begin(), count, m_minimums.begin());
+    std::copy_n(values.begin(), count, m_maximums.begin());
+    std::fill(m_isMaximumLast.begin(), m_isMaximumLast.end(), uint8_t{ 1 });
+  }
+  else
+  {
+    for (size_t channel = 0; channel < count; ++channel)
+    {
+      const float value = values[channel];
+      if (value < m_minimums[channel])
+      {
+        m_minimums[channel] = value;
+        m_isMaximumLast[channel] = 0;
+      }
+      else if (value > m_maximums[channel])
+      {
+        m_maximums[channel] = value;
+        m_isMaximumLast[channel] = 1;
+      }
+    }
+  }
+
+  // Buckets end at multiples of the bucket size; the first one after a Reset() may be shorter
+  ++m_nextSample;
+  if (m_nextSample % m_bucketSize != 0)
+  {
+    return 0;
+  }
+  m_bucketStart = m_nextSample;
+
+  if (m_bucketSize == 1)
+  {
+    std::copy_n(m_minimums.begin(), m_channelCount, m_points.begin());
+    return 1;
+  }
+  for (size_t channel = 0; channel < m_channelCount; ++channel)
+  {
+    const bool isMaximumLast = m_isMaximumLast[channel] != 0;
+    m_points[channel] = isMaximumLast ? m_minimums[channel] : m_maximums[channel];
+    m_points[m_channelCount + channel] = isMaximumLast ? m_maximums[channel] : m_minimums[channel];
+  }
+  return MAX_POINTS_PER_BUCKET;
+}
+
+} // namespace pacemaker
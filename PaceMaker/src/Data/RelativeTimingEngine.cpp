@@ -0,0 +1,104 @@
+#include <Data/RelativeTimingEngine.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+static TimeMs TimeToCover(float lapFraction, float trackLength, float speed)
+{
+  const float seconds = lapFraction * trackLength / std::max(speed, RelativeTimingEngine::MIN_SPEED);
+  return static_cast<TimeMs>(std::lround(seconds * 1000.0f));
+}
+
+//------------------------------------------------------------------------------
+// Distance from one lap fraction forward to another, wrapping over the line: 0 to 1
+static float ForwardDistance(float from, float to)
+{
+  const float distance = to - from;
+  return distance < 0.0f ? distance + 1.0f : distance;
+}
+
+//------------------------------------------------------------------------------
+static void SetRow(RelativePlayerData& row, const CarTrackState& car, TimeMs gap)
+{
+  row.position = car.position;
+  row.number = car.number;
+  row.name = car.name;
+  row.teamCode = car.teamCode;
+  row.gap = gap;
+  row.teamColorIndex = car.teamColorIndex;
+}
+
+//------------------------------------------------------------------------------
+RelativeTimingEngine::RelativeTimingEngine(float trackLength, int carsAround)
+  : m_trackLength(trackLength)
+  , m_carsAround(std::max(carsAround, 0))
+{
+}
+
+//------------------------------------------------------------------------------
+void RelativeTimingEngine::Update(std::span<const CarTrackState> cars, size_t playerIndex, RelativeTimingData& out)
+{
+  if (playerIndex >= cars.size())
+  {
+    out.players.clear();
+    return;
+  }
+
+  SortByLapDistance(cars);
+  const size_t slot = static_cast<size_t>(std::find(m_order.begin(), m_order.end(), playerIndex) - m_order.begin());
+  const CarTrackState& player = cars[playerIndex];
+
+  // Nearest cars on the circle: walking forward from the player finds those ahead, backward those behind
+  const size_t others = cars.size() - 1;
+  const size_t ahead = std::min(static_cast<size_t>(m_carsAround), others);
+  const size_t behind = std::min(static_cast<size_t>(m_carsAround), others - ahead);
+  const size_t count = m_order.size();
+
+  out.playerPosition = player.position;
+  out.players.resize(ahead + 1 + behind);
+  size_t row = 0;
+  for (size_t i = ahead; i > 0; --i)
+  {
+    const CarTrackState& car = cars[m_order[(slot + i) % count]];
+    const float distance = ForwardDistance(player.lapDistance, car.lapDistance);
+    SetRow(out.players[row++], car, TimeToCover(distance, m_trackLength, player.speed));
+  }
+  SetRow(out.players[row++], player, 0);
+  for (size_t i = 1; i <= behind; ++i)
+  {
+    const CarTrackState& car = cars[m_order[(slot + count - i) % count]];
+    const float distance = ForwardDistance(car.lapDistance, player.lapDistance);
+    SetRow(out.players[row++], car, -TimeToCover(distance, m_trackLength, car.speed));
+  }
+}
+
+//------------------------------------------------------------------------------
+void RelativeTimingEngine::SortByLapDistance(std::span<const CarTrackState> cars)
+{
+  if (m_order.size() != cars.size())
+  {
+    m_order.resize(cars.size());
+    std::iota(m_order.begin(), m_order.end(), size_t{ 0 });
+  }
+
+  // Insertion sort: linear on the nearly sorted order of the previous tick. A car crossing the line moves from the
+  // end to the front, one pass over the cars.
+  for (size_t i = 1; i < m_order.size(); ++i)
+  {
+    const size_t car = m_order[i];
+    const float distance = cars[car].lapDistance;
+    size_t j = i;
+    for (; j > 0 && cars[m_order[j - 1]].lapDistance > distance; --j)
+    {
+      m_order[j] = m_order[j - 1];
+    }
+    m_order[j] = car;
+  }
+}
+
+} // namespace pacemaker
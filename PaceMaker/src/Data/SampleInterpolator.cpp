@@ -0,0 +1,106 @@
+#include <Data/SampleInterpolator.h>
+
+#include <algorithm>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+SampleInterpolator::SampleInterpolator(size_t channelCount, float lead)
+  : m_lead(std::max(lead, 0.0f))
+{
+  Resize(channelCount);
+}
+
+//------------------------------------------------------------------------------
+void SampleInterpolator::Resize(size_t channelCount)
+{
+  m_hasSample = false;
+  m_interval = 0.0f;
+  m_samples.assign(channelCount, 0.0f);
+  m_origins.assign(channelCount, 0.0f);
+  m_slopes.assign(channelCount, 0.0f);
+  m_values.assign(channelCount, 0.0f);
+}
+
+//------------------------------------------------------------------------------
+void SampleInterpolator::Push(Clock::time_point time, std::span<const float> samples)
+{
+  if (samples.size() != Size())
+  {
+    Resize(samples.size());
+  }
+
+  const size_t count = samples.size();
+  const float interval = SecondsSince(time);
+  if (!m_hasSample || interval <= 0.0f || interval > MAX_INTERVAL)
+  {
+    // Nothing to take a trend from: show the sample as is until the next one
+    std::copy(samples.begin(), samples.end(), m_samples.begin());
+    std::copy(samples.begin(), samples.end(), m_origins.begin());
+    std::copy(samples.begin(), samples.end(), m_values.begin());
+    std::fill(m_slopes.begin(), m_slopes.end(), 0.0f);
+    m_interval = 0.0f;
+  }
+  else
+  {
+    // Restart each trajectory where it is displayed now, aimed at where the trend puts the channel one interval later
+    const float elapsed = std::min(interval, m_interval);
+    const float inverse = 1.0f / interval;
+    const float lead = m_lead;
+    const float* sample = samples.data();
+    float* previous = m_samples.data();
+    float* origin = m_origins.data();
+    float* slope = m_slopes.data();
+    for (size_t i = 0; i < count; ++i)
+    {
+      const float shown = origin[i] + slope[i] * elapsed;
+      const float target = sample[i] + (sample[i] - previous[i]) * lead;
+      origin[i] = shown;
+      slope[i] = (target - shown) * inverse;
+      previous[i] = sample[i];
+    }
+    m_interval = interval;
+  }
+
+  m_hasSample = true;
+  m_sampleTime = time;
+}
+
+//------------------------------------------------------------------------------
+void SampleInterpolator::Snap(size_t channel) noexcept
+{
+  if (channel < Size())
+  {
+    m_origins[channel] = m_samples[channel];
+    m_slopes[channel] = 0.0f;
+    m_values[channel] = m_samples[channel];
+  }
+}
+
+//------------------------------------------------------------------------------
+void SampleInterpolator::Evaluate(Clock::time_point time) noexcept
+{
+  if (!m_hasSample)
+  {
+    return;
+  }
+
+  const float elapsed = std::clamp(SecondsSince(time), 0.0f, m_interval);
+  const size_t count = m_values.size();
+  const float* origin = m_origins.data();
+  const float* slope = m_slopes.data();
+  float* value = m_values.data();
+  for (size_t i = 0; i < count; ++i)
+  {
+    value[i] = origin[i] + slope[i] * elapsed;
+  }
+}
+
+//------------------------------------------------------------------------------
+float SampleInterpolator::SecondsSince(Clock::time_point time) const noexcept
+{
+  return std::chrono::duration<float>(time - m_sampleTime).count();
+}
+
+} // namespace pacemaker
@@ -0,0 +1,76 @@
+#include <Data/StringTable.h>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+StringTable& StringTable::Instance()
+{
+  static StringTable instance;
+  return instance;
+}
+
+//------------------------------------------------------------------------------
+StringTable::StringTable()
+{
+  m_chunks[0] = std::make_unique<std::string[]>(CHUNK_SIZE);
+  m_index.emplace(std::string_view(m_chunks[0][0]), EMPTY_STRING_ID);
+  m_count.store(1, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+StringId StringTable::Intern(std::string_view text)
+{
+  std::lock_guard lock(m_internMutex);
+
+  if (auto it = m_index.find(text); it != m_index.end())
+  {
+    return it->second;
+  }
+
+  const uint32_t id = m_count.load(std::memory_order_relaxed);
+  const size_t chunk = id / CHUNK_SIZE;
+  if (chunk >= MAX_CHUNKS)
+  {
+    return EMPTY_STRING_ID;
+  }
+
+  if (!m_chunks[chunk])
+  {
+    m_chunks[chunk] = std::make_unique<std::string[]>(CHUNK_SIZE);
+  }
+
+  std::string& entry = m_chunks[chunk][id % CHUNK_SIZE];
+  entry.assign(text);
+  m_index.emplace(std::string_view(entry), id);
+
+  // Publishes the entry (and its chunk) to lock-free readers
+  m_count.store(id + 1, std::memory_order_release);
+  return id;
+}
+
+//------------------------------------------------------------------------------
+const std::string* StringTable::Find(StringId id) const noexcept
+{
+  if (id >= m_count.load(std::memory_order_acquire))
+  {
+    return nullptr;
+  }
+  return &m_chunks[id / CHUNK_SIZE][id % CHUNK_SIZE];
+}
+
+//------------------------------------------------------------------------------
+const char* StringTable::CStr(StringId id) const noexcept
+{
+  const std::string* entry = Find(id);
+  return entry ? entry->c_str() : "";
+}
+
+//------------------------------------------------------------------------------
+std::string_view StringTable::View(StringId id) const noexcept
+{
+  const std::string* entry = Find(id);
+  return entry ? std::string_view(*entry) : std::string_view();
+}
+
+} // namespace pacemaker
@@ -1,9 +1,11 @@
 #include <Overlays/InputTelemetryOverlay.h>
 
+#include <Utils/NumberFormat.h>
+#include <Utils/TextCache.h>
+
 #include <raylib.h>
 
 #include <algorithm>
-#include <cstdio>
 #include <cmath>
 
 namespace pacemaker
@@ -13,43 +15,149 @@ namespace pacemaker
   constexpr float BRAKE_THICKNESS = 2.0f;
   constexpr float STEERING_THICKNESS = 1.0f;
   constexpr int OPACITY = 200;
+
+  // Width of the graph area in an overlay of the given width, leaving room for the labels, bars and gear box
+  static int GetGraphWidth(int width)
+  {
+    const int barWidth = std::clamp((int)(width * 0.01f), 12, 15);
+    return std::max(width - 200 - (barWidth * 3) - 40, 1);
+  }
   //------------------------------------------------------------------------------
   InputTelemetryOverlay::InputTelemetryOverlay(
     Bounds bounds,
     MinSize minSize,
     Font* font,
-    DataBroker<InputTelemetryData>& broker)
-    : BaseWidget("InputTelemetry", bounds, minSize), m_font(font)
+    DataBroker<InputTelemetryData>& broker,
+    size_t historySize,
+    double historyRateHz)
+    : BaseWidget("InputTelemetry", bounds, minSize)
+    , m_historySize(std::max<size_t>(historySize, 2))
+    , m_history{ RingBuffer<float>(m_historySize), RingBuffer<float>(m_historySize), RingBuffer<float>(m_historySize) }
+    , m_downsampler(TRACE_COUNT)
+    , m_points{ RingBuffer<float>(m_historySize), RingBuffer<float>(m_historySize), RingBuffer<float>(m_historySize) }
+    , m_traces(m_historySize, TRACE_COUNT)
+    , m_font(font)
   {
+    m_traces.SetTrace(TRACE_THROTTLE, GREEN, THROTTLE_THICKNESS);
+    m_traces.SetTrace(TRACE_BRAKE, RED, BRAKE_THICKNESS);
+    m_traces.SetTrace(TRACE_STEERING, SKYBLUE, STEERING_THICKNESS);
+    RebuildGraph(MinMaxDownsampler::BucketSizeFor(m_historySize, GetGraphWidth(bounds.width)));
     m_subscriptionId = broker.Subscribe([this](const InputTelemetryData& data) {
       OnDataUpdated(data);
-      });
+      }, { .maxRateHz = historyRateHz, .policy = CoalescePolicy::Decimate });
   }
   //------------------------------------------------------------------------------
   void InputTelemetryOverlay::OnDataUpdated(const InputTelemetryData& data)
   {
+    // Only show gear changes between forward gears
+    if (!m_history[TRACE_THROTTLE].Empty() && m_data.gear != data.gear && m_data.gear > 0 && data.gear > 0)
+    {
+      m_gearShifts.push_back({ m_sampleCount, data.gear > m_data.gear });
+    }
     m_data = data;
 
-    // Add to history
-    m_history.push_back(data);
+    // Add to history, the rings drop the oldest sample once full
+    const float values[TRACE_COUNT] = { data.throttle, data.brake, data.steering };
+    for (size_t trace = 0; trace < TRACE_COUNT; ++trace)
+    {
+      m_history[trace].Push(values[trace]);
+    }
+    AddToGraph(values);
+    ++m_sampleCount;
+
+    const uint64_t oldestSample = m_sampleCount - m_history[TRACE_THROTTLE].Size();
+    while (!m_gearShifts.empty() && m_gearShifts.front().sample <= oldestSample)
+    {
+      m_gearShifts.pop_front();
+    }
+  }
+  //------------------------------------------------------------------------------
+  void InputTelemetryOverlay::Update([[maybe_unused]] float deltaTime)
+  {
+    // Resizing the overlay changes how many samples share a pixel column
+    const size_t bucketSize = MinMaxDownsampler::BucketSizeFor(m_historySize, GetGraphWidth(m_bounds.width));
+    if (bucketSize != m_downsampler.GetBucketSize())
+    {
+      RebuildGraph(bucketSize);
+    }
+  }
+  //------------------------------------------------------------------------------
+  void InputTelemetryOverlay::AddToGraph(std::span<const float> values)
+  {
+    const size_t pointCount = m_downsampler.Push(values);
+    for (size_t point = 0; point < pointCount; ++point)
+    {
+      const std::span<const float> pointValues = m_downsampler.GetPoint(point);
+      for (size_t trace = 0; trace < TRACE_COUNT; ++trace)
+      {
+        m_points[trace].Push(pointValues[trace]);
+      }
+      m_traces.Push(pointValues);
+    }
+  }
+  //------------------------------------------------------------------------------
+  void InputTelemetryOverlay::RebuildGraph(size_t bucketSize)
+  {
+    // Room for the points of every bucket the history spans
+    const size_t bucketCount = (m_historySize + bucketSize - 1) / bucketSize;
+    const size_t sampleCount = m_history[TRACE_THROTTLE].Size();
+    m_downsampler.Reset(bucketSize, m_sampleCount - sampleCount);
+    const size_t pointCapacity = bucketCount * m_downsampler.GetPointsPerBucket();
+    for (RingBuffer<float>& points : m_points)
+    {
+      if (points.Capacity() != pointCapacity)
+      {
+        points = RingBuffer<float>(pointCapacity);
+      }
+      points.Clear();
+    }
+    m_traces.SetCapacity(pointCapacity);
 
-    // Keep history size limited
-    if (m_history.size() > InputTelemetryData::MAX_HISTORY)
+    for (size_t i = 0; i < sampleCount; ++i)
     {
-      m_history.pop_front();
+      const float values[TRACE_COUNT] = { m_history[TRACE_THROTTLE][i], m_history[TRACE_BRAKE][i],
+        m_history[TRACE_STEERING][i] };
+      AddToGraph(values);
     }
   }
   //------------------------------------------------------------------------------
-  void InputTelemetryOverlay::Render() const
+  void InputTelemetryOverlay::ReleaseGraphicsResources()
   {
-    if (!m_isVisible) return;
+    BaseWidget::ReleaseGraphicsResources();
+    m_traces.Release();
+  }
+  //------------------------------------------------------------------------------
+  void InputTelemetryOverlay::DrawTracesLineByLine(float graphX, float xStep,
+    std::span<const TraceGraphBuffer::TraceLayout> layouts) const
+  {
+    static constexpr float THICKNESSES[TRACE_COUNT] = { THROTTLE_THICKNESS, BRAKE_THICKNESS, STEERING_THICKNESS };
+    const Color colors[TRACE_COUNT] = { GREEN, RED, SKYBLUE };
 
+    const size_t pointCount = m_points[TRACE_THROTTLE].Size();
+    for (size_t i = 1; i < pointCount; i++)
+    {
+      float x1 = graphX + (i - 1) * xStep;
+      float x2 = graphX + i * xStep;
+
+      // Throttle (green), brake (red) and steering (blue), in the order the vertex buffer draws them
+      for (size_t trace = 0; trace < TRACE_COUNT; ++trace)
+      {
+        const TraceGraphBuffer::TraceLayout& layout = layouts[trace];
+        float y1 = layout.baseline + m_points[trace][i - 1] * layout.scale;
+        float y2 = layout.baseline + m_points[trace][i] * layout.scale;
+        DrawLineEx({ x1, y1 }, { x2, y2 }, THICKNESSES[trace], colors[trace]);
+      }
+    }
+  }
+  //------------------------------------------------------------------------------
+  void InputTelemetryOverlay::RenderContent() const
+  {
     const auto& [x, y, width, height] = m_bounds;
 
     // Calculate responsive dimensions
     int barWidth = std::clamp((int)(width * 0.01f), 12, 15);
     int barHeight = height - 80;
-    int graphWidth = width - 200 - (barWidth * 3) - 40;
+    int graphWidth = GetGraphWidth(width);
     int graphHeight = height - 50;
 
     // Graph area background
@@ -65,70 +173,59 @@ namespace pacemaker
       DrawLine(graphX, gridY, graphX + graphWidth, gridY, Color{ 50, 50, 50, OPACITY / 2 });
     }
 
-    const auto historySize = m_history.size();
     // Draw input history timeline
-    if (historySize > 1)
+    if (m_points[TRACE_THROTTLE].Size() > 1)
     {
-      float xStep = (float)graphWidth / (float)InputTelemetryData::MAX_HISTORY;
+      // At most two points per pixel column, however many samples the history holds
+      const size_t bucketSize = m_downsampler.GetBucketSize();
+      const size_t pointsPerBucket = m_downsampler.GetPointsPerBucket();
+      float xStep = (float)graphWidth / (float)m_points[TRACE_THROTTLE].Capacity();
+      float bottomY = (float)(graphY + graphHeight);
+      float centerY = graphY + graphHeight / 2.0f;
+
+      // All three traces in one draw call from the vertex buffer, scrolled by the shader
+      const TraceGraphBuffer::TraceLayout layouts[TRACE_COUNT] = {
+        { bottomY, -(float)graphHeight },   // Throttle
+        { bottomY, -(float)graphHeight },   // Brake
+        { centerY, -graphHeight * 0.4f },   // Steering
+      };
+      if (!m_traces.Draw((float)graphX, xStep, layouts))
+      {
+        DrawTracesLineByLine((float)graphX, xStep, layouts);
+      }
 
-      for (size_t i = 1; i < historySize; i++)
+      /********************************************
+       * Gear indicators on the graph
+       ********************************************/
+      const uint64_t graphEnd = m_downsampler.GetBucketStart();
+      const uint64_t graphStart = graphEnd - m_points[TRACE_THROTTLE].Size() / pointsPerBucket * bucketSize;
+      const float sampleStep = xStep * pointsPerBucket / bucketSize;
+      for (const GearShift& shift : m_gearShifts)
       {
-        float x1 = graphX + (i - 1) * xStep;
-        float x2 = graphX + i * xStep;
-
-        // Throttle line (green)
-        float throttle1 = m_history[i - 1].throttle;
-        float throttle2 = m_history[i].throttle;
-        float y1_throttle = graphY + graphHeight - (throttle1 * graphHeight);
-        float y2_throttle = graphY + graphHeight - (throttle2 * graphHeight);
-        DrawLineEx({ x1, y1_throttle }, { x2, y2_throttle }, THROTTLE_THICKNESS, GREEN);
-
-        // Brake line (red)
-        float brake1 = m_history[i - 1].brake;
-        float brake2 = m_history[i].brake;
-        float y1_brake = graphY + graphHeight - (brake1 * graphHeight);
-        float y2_brake = graphY + graphHeight - (brake2 * graphHeight);
-        DrawLineEx({ x1, y1_brake }, { x2, y2_brake }, BRAKE_THICKNESS, RED);
-
-        // Draw steering line (blue)
-        float steering1 = m_history[i - 1].steering;
-        float steering2 = m_history[i].steering;
-        float centerY = graphY + graphHeight / 2.0f;
-        float y1_steering = centerY - (steering1 * graphHeight * 0.4f);
-        float y2_steering = centerY - (steering2 * graphHeight * 0.4f);
-        DrawLineEx({ x1, y1_steering }, { x2, y2_steering }, STEERING_THICKNESS, SKYBLUE);
-
-        /********************************************
-         * Gear indicators on the graph
-         ********************************************/
-
-        // Detect gear changes and draw shift indicators
-        short gear1 = m_history[i - 1].gear;
-        short gear2 = m_history[i].gear;
-
-        if (gear1 != gear2 && gear1 > 0 && gear2 > 0) // Only show for forward gears
+        if (shift.sample < graphStart || shift.sample >= graphEnd)
+        {
+          continue;
+        }
+        float triangleSize = 12.0f;
+        float triangleX = graphX + (float)(shift.sample - graphStart) * sampleStep;
+
+        if (shift.isUpshift)
+        {
+          // Draw upward pointing triangle at the top
+          float triangleY = graphY; // Position near top of graph
+          Vector2 p1 = { triangleX, triangleY };
+          Vector2 p2 = { triangleX - triangleSize / 2.0f, triangleY + triangleSize };
+          Vector2 p3 = { triangleX + triangleSize / 2.0f, triangleY + triangleSize };
+          DrawTriangle(p1, p2, p3, GREEN);
+        }
+        else // Downshift
         {
-          float triangleSize = 12.0f;
-          float triangleX = x2;
-
-          if (gear2 > gear1) // Upshift
-          {
-            // Draw upward pointing triangle at the top
-            float triangleY = graphY; // Position near top of graph
-            Vector2 p1 = { triangleX, triangleY };
-            Vector2 p2 = { triangleX - triangleSize / 2.0f, triangleY + triangleSize };
-            Vector2 p3 = { triangleX + triangleSize / 2.0f, triangleY + triangleSize };
-            DrawTriangle(p1, p2, p3, GREEN);
-          }
-          else // Downshift
-          {
-            // Draw downward pointing triangle at the bottom
-            float triangleY = graphY + graphHeight - triangleSize; // Position near bottom with margin
-            Vector2 p1 = { triangleX, triangleY + triangleSize }; // Apex points down
-            Vector2 p2 = { triangleX - triangleSize / 2.0f, triangleY }; // Top left
-            Vector2 p3 = { triangleX + triangleSize / 2.0f, triangleY }; // Top right
-            DrawTriangle(p3, p2, p1, Color{ 255, 191, 0, 255 }); // Amber, draws CCW order
-          }
+          // Draw downward pointing triangle at the bottom
+          float triangleY = graphY + graphHeight - triangleSize; // Position near bottom with margin
+          Vector2 p1 = { triangleX, triangleY + triangleSize }; // Apex points down
+          Vector2 p2 = { triangleX - triangleSize / 2.0f, triangleY }; // Top left
+          Vector2 p3 = { triangleX + triangleSize / 2.0f, triangleY }; // Top right
+          DrawTriangle(p3, p2, p1, Color{ 255, 191, 0, 255 }); // Amber, draws CCW order
         }
       }
     }
@@ -178,11 +275,12 @@ namespace pacemaker
     static constexpr int rpmFontSize = 18;
 
     // Format RPM text (assuming rpm is normalized 0-1, display as actual RPM)
-    char rpmText[6];
-    snprintf(rpmText, sizeof(rpmText), "%d", (int)(m_data.rpm * 10000)); // Assuming max 10000 RPM
+    char rpmBuffer[8];
+    const std::string_view rpmText = FormatInteger(rpmBuffer, (int)(m_data.rpm * 10000)); // Assuming max 10000 RPM
 
     // Calculate text centering for RPM
-    Vector2 rpmTextSize = MeasureTextEx(*m_font, rpmText, rpmFontSize, 1);
+    auto& textCache = TextCache::Instance();
+    Vector2 rpmTextSize = textCache.Measure(*m_font, rpmText, rpmFontSize, 1);
 
     // RPM display
     int rpmBoxHeight = rpmTextSize.y + 5;
@@ -197,27 +295,28 @@ namespace pacemaker
     DrawRectangleLines(gearRpmX, gearBoxY, gearRpmWidth, gearBoxHeight, Color{ 70, 70, 70, OPACITY });
 
     // Format gear text (R for reverse, N for neutral)
-    char gearText[2];
+    char gearBuffer[4];
+    std::string_view gearText;
     if (m_data.gear == -1)
-      snprintf(gearText, sizeof(gearText), "R");
+      gearText = "R";
     else if (m_data.gear == 0)
-      snprintf(gearText, sizeof(gearText), "N");
+      gearText = "N";
     else
-      snprintf(gearText, sizeof(gearText), "%d", m_data.gear);
+      gearText = FormatInteger(gearBuffer, m_data.gear);
 
     // Calculate text centering for gear
     static constexpr int gearFontSize = 96;
-    Vector2 gearTextSize = MeasureTextEx(*m_font, gearText, gearFontSize, 2);
+    Vector2 gearTextSize = textCache.Measure(*m_font, gearText, gearFontSize, 2);
     float gearTextX = gearRpmX + (gearRpmWidth - gearTextSize.x) / 2.0f;
     float gearTextY = gearBoxY + (gearBoxHeight - gearTextSize.y) / 2.0f;
 
     // Draw gear text centered in gear box
-    DrawTextEx(*m_font, gearText, { gearTextX, gearTextY }, gearFontSize, 2, Color{ 255, 191, 0, OPACITY }); // Amber color
+    textCache.Draw(*m_font, gearText, { gearTextX, gearTextY }, gearFontSize, 2, Color{ 255, 191, 0, OPACITY }); // Amber color
 
     // Draw RPM text centered in rpm box
     float rpmTextX = gearRpmX + (gearRpmWidth - rpmTextSize.x) / 2.0f;
     float rpmTextY = rpmBoxY + (rpmBoxHeight - rpmTextSize.y) / 2.0f;
-    DrawTextEx(*m_font, rpmText, { rpmTextX, rpmTextY }, rpmFontSize, 1, BEIGE);
+    textCache.Draw(*m_font, rpmText, { rpmTextX, rpmTextY }, rpmFontSize, 1, BEIGE);
   }
 
 } // namespace pacemaker
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include <Overlays/LeaderboardOverlay.h>
 
 #include <Utils/FontManager.h>
+#include <Utils/TimeFormat.h>
+#include <Utils/NumberFormat.h>
+#include <Utils/TextCache.h>
+#include <Data/StringTable.h>
 
 #include <raylib.h>
 
 #include <algorithm>
-#include <cstdio>
+#include <cmath>
 
 namespace pacemaker
 {
@@ -16,56 +20,154 @@ LeaderboardOverlay::LeaderboardOverlay(
     Font* font,
     std::span<const Color> teamColors,
     DataBroker<LeaderboardData>& broker)
-    : BaseWidget("Leaderboard", bounds, minSize), m_font(font), m_teamColors(teamColors)
+    : BaseWidget("Leaderboard", bounds, minSize), m_reader(broker), m_font(font), m_teamColors(teamColors)
 {
     m_font = FontManager::Instance().GetRegularFont();
-    // Subscribe to data updates
-    m_subscriptionId = broker.Subscribe([this](const LeaderboardData& data) {
-        OnDataUpdated(data);
-    });
+    // Redrawn when a snapshot arrives or a shown gap or battery ticks over, not every frame
+    EnableRenderCache();
 }
 //------------------------------------------------------------------------------
-void LeaderboardOverlay::DrawPlayerRow(const PlayerData& player, int x, int y, int rowHeight, bool isHighlighted) const {
+void LeaderboardOverlay::Update([[maybe_unused]] float deltaTime) {
+    const bool hasNewData = m_reader.Poll();
+    if (hasNewData || m_rowText.size() != m_reader.Get().players.size()) {
+        RefreshRowText(m_reader.Get());
+        InvalidateRenderCache();
+    }
+    UpdateSmoothedColumns(hasNewData);
+
+    // No copy and no re-layout unless something was published or the widget was moved/resized
+    if (!hasNewData && m_layoutBounds == m_bounds)
+        return;
+
+    m_layoutBounds = m_bounds;
+
+    constexpr int headerHeight = 40;
+    const auto& players = m_reader.Get().players;
+    int availableHeight = m_bounds.height - headerHeight;
+    const int rowHeight = !players.empty() ?
+        std::clamp(availableHeight / static_cast<int>(players.size()), 25, 50) : 35;
+    if (rowHeight != m_rowHeight) {
+        m_rowHeight = rowHeight;
+        InvalidateRenderCache();
+    }
+}
+//------------------------------------------------------------------------------
+Bounds LeaderboardOverlay::GetContentBounds() const {
+    constexpr int headerHeight = 40;
+    const int rowsHeight = headerHeight + static_cast<int>(m_grid.Size()) * m_rowHeight;
+    return Bounds{ m_bounds.x, m_bounds.y, std::max(m_bounds.width, 500), std::max(m_bounds.height, rowsHeight) };
+}
+//------------------------------------------------------------------------------
+void LeaderboardOverlay::RefreshRowText(const LeaderboardData& data) {
+    m_dirtyRows.Collect(data, m_rowTextRevision, m_rowText.size());
+    m_grid.Update(data.players, m_dirtyRows);
+    m_rowText.resize(data.players.size(), RowText{ {}, {}, {}, {}, NO_TIME, -1 });
+    m_rowTextRevision = data.revision;
+
+    if (data.sessionTime != m_sessionTimeFormatted || m_sessionTimeText[0] == '\0') {
+        FormatSessionTime(m_sessionTimeText, sizeof(m_sessionTimeText), data.sessionTime);
+        m_sessionTimeFormatted = data.sessionTime;
+    }
+
+    for (size_t row = 0; row < data.players.size(); ++row) {
+        if (!m_dirtyRows.IsDirty(row))
+            continue;
+
+        const auto& player = data.players[row];
+        auto& text = m_rowText[row];
+        FormatInteger(text.position, player.position);
+        FormatInteger(text.number, player.number);
+    }
+}
+//------------------------------------------------------------------------------
+void LeaderboardOverlay::UpdateSmoothedColumns(bool hasNewData) {
+    const auto now = SampleInterpolator::Clock::now();
+    const auto& players = m_reader.Get().players;
+    const size_t rows = players.size();
+
+    if (hasNewData || m_columnSamples.size() != 2 * rows) {
+        const bool isSameLayout = m_rowNumbers.size() == rows;
+        m_columnSamples.resize(2 * rows);
+        m_rowNumbers.resize(rows);
+        for (size_t row = 0; row < rows; ++row) {
+            m_columnSamples[row] = players[row].gap != NO_TIME ? static_cast<float>(players[row].gap) : 0.0f;
+            m_columnSamples[rows + row] = static_cast<float>(players[row].batteryPercent);
+        }
+
+        m_columns.Push(now, m_columnSamples);
+        for (size_t row = 0; row < rows; ++row) {
+            // An overtake puts another car in the row; a row without a gap has no trend either
+            if (!isSameLayout || m_rowNumbers[row] != players[row].number) {
+                m_columns.Snap(row);
+                m_columns.Snap(rows + row);
+            }
+            m_rowNumbers[row] = players[row].gap != NO_TIME ? players[row].number : -1;
+        }
+    }
+
+    // Reformat a row only when the millisecond or the percent it shows changes
+    m_columns.Evaluate(now);
+    const auto values = m_columns.GetValues();
+    for (size_t row = 0; row < m_rowText.size(); ++row) {
+        auto& text = m_rowText[row];
+        const TimeMs gap = players[row].gap != NO_TIME ? static_cast<TimeMs>(std::lround(values[row])) : NO_TIME;
+        if (gap != text.shownGap) {
+            text.shownGap = gap;
+            FormatGap(text.gap, sizeof(text.gap), gap, 3);
+            InvalidateRenderCache();
+        }
+
+        // Dead reckoning may overshoot a full or empty battery for a moment; the bar stays within its frame
+        const int battery = std::clamp(static_cast<int>(std::lround(values[rows + row])), 0, 100);
+        if (battery != text.shownBattery) {
+            text.shownBattery = battery;
+            FormatInteger(text.battery, battery, "%");
+            InvalidateRenderCache();
+        }
+    }
+}
+//------------------------------------------------------------------------------
+void LeaderboardOverlay::DrawPlayerRow(const FieldTable::RowView& player, const RowText& text, int x, int y, int rowHeight, bool isHighlighted) const {
     // Row background
     Color bgColor = isHighlighted ? Color{70, 70, 70, 200} : Color{40, 40, 40, 180};
     DrawRectangle(x, y, 500, rowHeight, bgColor);
 
+    auto& textCache = TextCache::Instance();
     int currentX = x + 10;
     int textY = y + (rowHeight / 2) - 8;
 
     // Position number
-    char posStr[8];
-    snprintf(posStr, sizeof(posStr), "%d", player.position);
-    DrawTextEx(*m_font, posStr, {(float)currentX, (float)textY}, 20, 1, WHITE);
+    textCache.Draw(*m_font, text.position, {(float)currentX, (float)textY}, 20, 1, WHITE);
     currentX += 35;
 
     // Team color indicator (small square)
-    DrawRectangle(currentX, y + 8, 6, rowHeight - 16, m_teamColors[player.teamColorIndex]);
+    // The index arrives from telemetry unchecked; an unknown team gets a neutral color
+    const Color teamColor = static_cast<size_t>(player.teamColorIndex) < m_teamColors.size()
+      ? m_teamColors[player.teamColorIndex] : GRAY;
+    DrawRectangle(currentX, y + 8, 6, rowHeight - 16, teamColor);
     currentX += 15;
 
     // Driver number
-    char numStr[8];
-    snprintf(numStr, sizeof(numStr), "%d", player.number);
-    DrawTextEx(*m_font, numStr, {(float)currentX, (float)textY}, 18, 1, Color{200, 200, 200, 255});
+    textCache.Draw(*m_font, text.number, {(float)currentX, (float)textY}, 18, 1, Color{200, 200, 200, 255});
     currentX += 35;
 
     // Driver name
-    DrawTextEx(*m_font, player.name.c_str(), {(float)currentX, (float)textY}, 18, 1, WHITE);
+    textCache.Draw(*m_font, StringTable::Instance().View(player.name), {(float)currentX, (float)textY}, 18, 1, WHITE);
     currentX = x + 280;
 
     // Current/Best time or Gap
-    const char* timeText = player.gap.c_str();
+    const char* timeText = text.gap;
     Color timeColor = player.inPit ? Color{255, 165, 0, 255} : WHITE;
-    DrawTextEx(*m_font, timeText, {(float)currentX, (float)textY}, 18, 1, timeColor);
+    textCache.Draw(*m_font, timeText, {(float)currentX, (float)textY}, 18, 1, timeColor);
     currentX = x + 380;
 
     auto boldFont = FontManager::Instance().GetBoldFont();
     // Pit indicator or S indicator
     if (player.inPit) {
-      DrawTextEx(*boldFont, "PIT", { (float)currentX, (float)textY }, 16, 1, Color{ 255, 165, 0, 255 });
+      textCache.Draw(*boldFont, "PIT", { (float)currentX, (float)textY }, 16, 1, Color{ 255, 165, 0, 255 });
     } else {
         DrawCircle(currentX + 10, y + rowHeight / 2, 10, Color{200, 200, 200, 255});
-        DrawTextEx(*m_font, "S", { (float)currentX + 6, (float)textY }, 14, 1, BLACK);
+        textCache.Draw(*m_font, "S", { (float)currentX + 6, (float)textY }, 14, 1, BLACK);
     }
     currentX += 35;
 
@@ -74,45 +176,38 @@ void LeaderboardOverlay::DrawPlayerRow(const PlayerData& player, int x, int y, i
     int barHeight = 16;
     DrawRectangle(currentX, y + (rowHeight - barHeight) / 2, barWidth, barHeight, Color{60, 60, 60, 255});
 
-    int fillWidth = (int)(barWidth * (player.batteryPercent / 100.0f));
-    Color batteryColor = player.batteryPercent > 50 ? Color{0, 255, 0, 255} :
-                         player.batteryPercent > 20 ? Color{255, 165, 0, 255} :
+    int fillWidth = (int)(barWidth * (text.shownBattery / 100.0f));
+    Color batteryColor = text.shownBattery > 50 ? Color{0, 255, 0, 255} :
+                         text.shownBattery > 20 ? Color{255, 165, 0, 255} :
                          Color{255, 0, 0, 255};
     DrawRectangle(currentX, y + (rowHeight - barHeight) / 2, fillWidth, barHeight, batteryColor);
 
     // Battery percentage text
-    char batteryStr[8];
-    snprintf(batteryStr, sizeof(batteryStr), "%d%%", player.batteryPercent);
-    DrawTextEx(*boldFont, batteryStr, { (float)(currentX + 5), (float)(y + (rowHeight - barHeight) / 2 + 2) }, 12, 1, WHITE);
+    textCache.Draw(*boldFont, text.battery, { (float)(currentX + 5), (float)(y + (rowHeight - barHeight) / 2 + 2) }, 12, 1, WHITE);
 }
 //------------------------------------------------------------------------------
-void LeaderboardOverlay::Render() const {
-    if (!m_isVisible) return;
-
+void LeaderboardOverlay::RenderContent() const {
     const auto& [x, y, width, height] = m_bounds;
+    const auto& data = m_reader.Get();
     
     // Header
     constexpr int headerHeight = 40;
     DrawRectangle(x, y, width, headerHeight, Color{20, 20, 20, 220});
     
-    DrawTextEx(*m_font, m_data.sessionType.c_str(),
-               {(float)(x + 10), (float)(y + 10)}, 20, 1, WHITE);
+    auto& textCache = TextCache::Instance();
+    textCache.Draw(*m_font, StringTable::Instance().View(data.sessionType),
+                   {(float)(x + 10), (float)(y + 10)}, 20, 1, WHITE);
     
     int timeX = x + width - 100;
-    DrawTextEx(*m_font, m_data.sessionTime.c_str(),
-               {(float)timeX, (float)(y + 10)}, 20, 1, WHITE);
-
-    // Calculate row height
-    int availableHeight = height - headerHeight;
-    int rowHeight = !m_data.players.empty() ? 
-        std::clamp(availableHeight / static_cast<int>(m_data.players.size()), 25, 50) : 35;
+    textCache.Draw(*m_font, m_sessionTimeText,
+                   {(float)timeX, (float)(y + 10)}, 20, 1, WHITE);
 
     // Draw player rows
     int startY = y + headerHeight;
     int index = 0;
     
-    for (const auto& player : m_data.players) {
-        DrawPlayerRow(player, x, startY + (index * rowHeight), rowHeight, index == 0);  
+    for (size_t row = 0; row < m_grid.Size(); ++row) {
+        DrawPlayerRow(m_grid.Row(row), m_rowText[row], x, startY + (index * m_rowHeight), m_rowHeight, index == 0);  
         ++index;
     }
 }
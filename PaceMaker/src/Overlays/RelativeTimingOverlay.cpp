@@ -1,9 +1,13 @@
 #include <Overlays/RelativeTimingOverlay.h>
 
+#include <Utils/TimeFormat.h>
+#include <Utils/NumberFormat.h>
+#include <Utils/TextCache.h>
+#include <Data/StringTable.h>
+
 #include <raylib.h>
 
 #include <algorithm>
-#include <cstdio>
 #include <cmath>
 
 namespace pacemaker
@@ -17,20 +21,99 @@ RelativeTimingOverlay::RelativeTimingOverlay(
     DataBroker<RelativeTimingData>& broker
 )
     : BaseWidget("RelativeTiming", bounds, minSize)
+    , m_reader(broker)
     , m_font(font)
     , m_teamColors(teamColors)
 {
-    m_subscriptionId = broker.Subscribe([this](const RelativeTimingData& data) {
-        OnDataUpdated(data);
-    });
+    // Redrawn when a snapshot arrives or a shown gap ticks over, not every frame
+    EnableRenderCache();
 }
 //------------------------------------------------------------------------------
-void RelativeTimingOverlay::DrawPlayerRow(const RelativePlayerData& player, int x, int y, int rowHeight, bool isPlayer, int width) const
+void RelativeTimingOverlay::Update([[maybe_unused]] float deltaTime)
+{
+    const bool hasNewData = m_reader.Poll();
+    const auto& players = m_reader.Get().players;
+
+    if (hasNewData || m_rowText.size() != players.size())
+    {
+        InvalidateRenderCache();
+        m_grid.Assign(players);
+        m_rowText.resize(players.size(), RowText{ {}, {}, NO_TIME });
+        for (size_t i = 0; i < players.size(); i++)
+            FormatInteger(m_rowText[i].position, players[i].position);
+    }
+    UpdateGaps(hasNewData);
+
+    if (!hasNewData && m_layoutBounds == m_bounds)
+        return;
+
+    m_layoutBounds = m_bounds;
+
+    constexpr int headerHeight = 35;
+    int availableHeight = m_bounds.height - headerHeight;
+    const int rowHeight = !players.empty() ?
+        std::clamp(availableHeight / static_cast<int>(players.size()), 28, 50) : 38;
+    if (rowHeight != m_rowHeight)
+    {
+        m_rowHeight = rowHeight;
+        InvalidateRenderCache();
+    }
+}
+//------------------------------------------------------------------------------
+Bounds RelativeTimingOverlay::GetContentBounds() const
+{
+    // Rows keep a minimum height, so many of them can run past the bottom edge
+    constexpr int headerHeight = 35;
+    const int rowsHeight = headerHeight + static_cast<int>(m_grid.Size()) * m_rowHeight;
+    return Bounds{ m_bounds.x, m_bounds.y, m_bounds.width, std::max(m_bounds.height, rowsHeight) };
+}
+//------------------------------------------------------------------------------
+void RelativeTimingOverlay::UpdateGaps(bool hasNewData)
+{
+    const auto now = SampleInterpolator::Clock::now();
+    const auto& players = m_reader.Get().players;
+
+    if (hasNewData || m_gapSamples.size() != players.size())
+    {
+        const bool isSameLayout = m_rowNumbers.size() == players.size();
+        m_gapSamples.resize(players.size());
+        m_rowNumbers.resize(players.size());
+        for (size_t i = 0; i < players.size(); i++)
+            m_gapSamples[i] = players[i].gap != NO_TIME ? static_cast<float>(players[i].gap) : 0.0f;
+
+        m_gaps.Push(now, m_gapSamples);
+        for (size_t i = 0; i < players.size(); i++)
+        {
+            // A row without a gap has no trend either, so the next gap it gets starts over like a new car
+            if (!isSameLayout || m_rowNumbers[i] != players[i].number)
+                m_gaps.Snap(i);
+            m_rowNumbers[i] = players[i].gap != NO_TIME ? players[i].number : -1;
+        }
+    }
+
+    // Reformat a row only when the tenth it shows changes, a few times a second per row rather than every frame
+    m_gaps.Evaluate(now);
+    const auto gaps = m_gaps.GetValues();
+    for (size_t i = 0; i < m_rowText.size(); i++)
+    {
+        const TimeMs tenths = static_cast<TimeMs>(std::lround(gaps[i] / 100.0f));
+        const TimeMs gap = players[i].gap != NO_TIME ? tenths * 100 : NO_TIME;
+        if (gap == m_rowText[i].shownGap)
+            continue;
+
+        m_rowText[i].shownGap = gap;
+        FormatGap(m_rowText[i].gap, sizeof(m_rowText[i].gap), gap, 1);
+        InvalidateRenderCache();
+    }
+}
+//------------------------------------------------------------------------------
+void RelativeTimingOverlay::DrawPlayerRow(const FieldTable::RowView& player, const RowText& text, int x, int y, int rowHeight, bool isPlayer, int width) const
 {
     // Row background - highlight player's row
     Color bgColor = isPlayer ? Color{60, 60, 80, 200} : Color{40, 40, 40, 180};
     DrawRectangle(x, y, width, rowHeight, bgColor);
 
+    auto& textCache = TextCache::Instance();
     int currentX = x + 10;
     int textY = y + (rowHeight / 2) - 10;
 
@@ -40,43 +123,37 @@ void RelativeTimingOverlay::DrawPlayerRow(const RelativePlayerData& player, int
                      Color{100, 100, 100, 255};
     DrawRectangle(currentX, y + 8, 26, rowHeight - 16, posColor);
     
-    char posStr[8];
-    snprintf(posStr, sizeof(posStr), "%d", player.position);
-    DrawTextEx(*m_font, posStr, {(float)(currentX + (player.position < 10 ? 8 : 4)), (float)(y + 11)}, 18, 1, WHITE);
+    textCache.Draw(*m_font, text.position, {(float)(currentX + (player.position < 10 ? 8 : 4)), (float)(y + 11)}, 18, 1, WHITE);
     currentX += 35;
 
     // Team code box
-    DrawRectangle(currentX, y + 8, 36, rowHeight - 16, m_teamColors[player.teamColorIndex]);
-    DrawTextEx(*m_font, player.teamCode.c_str(), {(float)(currentX + 4), (float)(y + 11)}, 14, 1, WHITE);
+    // The index arrives from telemetry unchecked; an unknown team gets a neutral color
+    const Color teamColor = static_cast<size_t>(player.teamColorIndex) < m_teamColors.size()
+      ? m_teamColors[player.teamColorIndex] : GRAY;
+    DrawRectangle(currentX, y + 8, 36, rowHeight - 16, teamColor);
+    textCache.Draw(*m_font, StringTable::Instance().View(player.teamCode), {(float)(currentX + 4), (float)(y + 11)}, 14, 1, WHITE);
     currentX += 45;
 
     // Driver name
-    DrawTextEx(*m_font, player.name.c_str(), {(float)currentX, (float)textY}, 18, 1, WHITE);
+    textCache.Draw(*m_font, StringTable::Instance().View(player.name), {(float)currentX, (float)textY}, 18, 1, WHITE);
 
     // Gap - position relative to right edge
     int gapX = x + width - 120;
-    char gapStr[16];
-    if (std::abs(player.gap) < 0.01f)
-        snprintf(gapStr, sizeof(gapStr), "0.0");
-    else
-        snprintf(gapStr, sizeof(gapStr), "%+.1f", player.gap);
+    Color gapColor = text.shownGap > 0 ? Color{100, 200, 100, 255} : Color{200, 100, 100, 255};
+    if (text.shownGap == NO_TIME || std::abs(text.shownGap) < 10) gapColor = WHITE;
 
-    Color gapColor = player.gap > 0 ? Color{100, 200, 100, 255} : Color{200, 100, 100, 255};
-    if (std::abs(player.gap) < 0.01f) gapColor = WHITE;
-
-    DrawTextEx(*m_font, gapStr, {(float)gapX, (float)textY}, 20, 1, gapColor);
+    textCache.Draw(*m_font, text.gap, {(float)gapX, (float)textY}, 20, 1, gapColor);
 }
 //------------------------------------------------------------------------------
-void RelativeTimingOverlay::Render() const
+void RelativeTimingOverlay::RenderContent() const
 {
-    if (!m_isVisible) return;
-
     const auto& [x, y, width, height] = m_bounds;
+    const auto& data = m_reader.Get();
     constexpr int headerHeight = 35;
 
     // Header background
     DrawRectangle(x, y, width, headerHeight, Color{20, 20, 20, 220});
-    DrawTextEx(*m_font, "Relative", {(float)(x + 10), (float)(y + 8)}, 18, 1, WHITE);
+    TextCache::Instance().Draw(*m_font, "Relative", {(float)(x + 10), (float)(y + 8)}, 18, 1, WHITE);
 
     // Icons placeholder (top right)
     int iconX = x + width - 150;
@@ -85,17 +162,13 @@ void RelativeTimingOverlay::Render() const
         DrawCircle(iconX + (i * 22), y + 17, 8, Color{80, 80, 80, 200});
     }
 
-    // Calculate row height
-    int availableHeight = height - headerHeight;
-    int rowHeight = !m_data.players.empty() ? 
-        std::clamp(availableHeight / static_cast<int>(m_data.players.size()), 28, 50) : 38;
-
     // Draw player rows
     int startY = y + headerHeight;
-    for (size_t i = 0; i < m_data.players.size(); i++)
+    const auto positions = m_grid.Positions();
+    for (size_t i = 0; i < m_grid.Size(); i++)
     {
-        bool isPlayer = (m_data.players[i].position == m_data.playerPosition);
-        DrawPlayerRow(m_data.players[i], x, startY + (i * rowHeight), rowHeight, isPlayer, width);
+        bool isPlayer = (positions[i] == data.playerPosition);
+        DrawPlayerRow(m_grid.Row(i), m_rowText[i], x, startY + (i * m_rowHeight), m_rowHeight, isPlayer, width);
     }
 }
 
@@ -1,9 +1,12 @@
 #include <Overlays/SpeedometerOverlay.h>
+#include <Utils/TimeFormat.h>
+#include <Utils/NumberFormat.h>
+#include <Utils/TextCache.h>
 
 #include <raylib.h>
 
 #include <algorithm>
-#include <cstdio>
+#include <cmath>
 
 namespace pacemaker
 {
@@ -15,18 +18,37 @@ SpeedometerOverlay::SpeedometerOverlay(
     DataBroker<VehicleData>& broker
 )
     : BaseWidget("Speedometer", bounds, minSize)
+    , m_reader(broker)
     , m_font(font)
 {
-    m_subscriptionId = broker.Subscribe([this](const VehicleData& data) {
-        OnDataUpdated(data);
-    });
+    FormatLapTime(m_lapTimeText, sizeof(m_lapTimeText), m_reader.Get().lapTime);
+    FormatLapTime(m_lastLapText, sizeof(m_lastLapText), m_reader.Get().lastLap);
 }
 //------------------------------------------------------------------------------
-void SpeedometerOverlay::Render() const
+void SpeedometerOverlay::Update([[maybe_unused]] float deltaTime)
+{
+    const auto now = SampleInterpolator::Clock::now();
+    const VehicleData previous = m_reader.Get();
+    if (m_reader.Poll())
+    {
+        const auto& data = m_reader.Get();
+        if (data.lapTime != previous.lapTime)
+            FormatLapTime(m_lapTimeText, sizeof(m_lapTimeText), data.lapTime);
+        if (data.lastLap != previous.lastLap)
+            FormatLapTime(m_lastLapText, sizeof(m_lastLapText), data.lastLap);
+
+        const float dials[DIAL_COUNT] = { data.rpm, static_cast<float>(data.speed) };
+        m_dials.Push(now, dials);
+    }
+    m_dials.Evaluate(now);
+}
+//------------------------------------------------------------------------------
+void SpeedometerOverlay::RenderContent() const
 {
-    if (!m_isVisible) return;
-
     const auto& [x, y, width, height] = m_bounds;
+    const auto& data = m_reader.Get();
+    const auto dials = m_dials.GetValues();
+    const float rpm = std::clamp(dials[DIAL_RPM], 0.0f, 1.0f);
 
     // Scale based on available space
     float scale = std::min(width / 250.0f, height / 270.0f);
@@ -40,11 +62,11 @@ void SpeedometerOverlay::Render() const
     DrawCircle(centerX, centerY, radius + 8, Color{50, 50, 60, 255});
 
     // RPM arc
-    float rpmAngle = m_data.rpm * 270.0f;
+    float rpmAngle = rpm * 270.0f;
     float startAngle = 135.0f;
 
-    Color rpmColor = m_data.rpm < 0.85f ? Color{0, 255, 0, 255} :
-                     m_data.rpm < 0.95f ? Color{255, 165, 0, 255} :
+    Color rpmColor = rpm < 0.85f ? Color{0, 255, 0, 255} :
+                     rpm < 0.95f ? Color{255, 165, 0, 255} :
                      Color{255, 0, 0, 255};
 
     DrawCircleSector({(float)centerX, (float)centerY}, radius - 5, startAngle, startAngle + rpmAngle, 32, rpmColor);
@@ -54,20 +76,21 @@ void SpeedometerOverlay::Render() const
 
     // Gear number
     char gearStr[8];
-    snprintf(gearStr, sizeof(gearStr), "%d", m_data.gear);
+    FormatInteger(gearStr, data.gear);
     int gearSize = (int)(80 * scale);
     int gearWidth = MeasureText(gearStr, gearSize);
     DrawText(gearStr, centerX - gearWidth / 2, centerY - (int)(50 * scale), gearSize, WHITE);
 
     // Speed
+    auto& textCache = TextCache::Instance();
     char speedStr[16];
-    snprintf(speedStr, sizeof(speedStr), "%d", m_data.speed);
+    FormatInteger(speedStr, std::lround(std::max(dials[DIAL_SPEED], 0.0f)));
     int speedSize = (int)(40 * scale);
-    DrawTextEx(*m_font, speedStr, {(float)(centerX - (int)(30 * scale)), (float)(centerY + (int)(10 * scale))}, speedSize, 1, WHITE);
-    DrawTextEx(*m_font, "MPH", {(float)(centerX - (int)(25 * scale)), (float)(centerY + (int)(50 * scale))}, (int)(16 * scale), 1, Color{180, 180, 180, 255});
+    textCache.Draw(*m_font, speedStr, {(float)(centerX - (int)(30 * scale)), (float)(centerY + (int)(10 * scale))}, speedSize, 1, WHITE);
+    textCache.Draw(*m_font, "MPH", {(float)(centerX - (int)(25 * scale)), (float)(centerY + (int)(50 * scale))}, (int)(16 * scale), 1, Color{180, 180, 180, 255});
 
     // FFB indicator
-    DrawTextEx(*m_font, "FFB", {(float)(centerX - (int)(20 * scale)), (float)(centerY + (int)(70 * scale))}, (int)(12 * scale), 1, Color{150, 150, 150, 255});
+    textCache.Draw(*m_font, "FFB", {(float)(centerX - (int)(20 * scale)), (float)(centerY + (int)(70 * scale))}, (int)(12 * scale), 1, Color{150, 150, 150, 255});
 
     // Icons on the left side
     int iconY = centerY - (int)(30 * scale);
@@ -81,11 +104,9 @@ void SpeedometerOverlay::Render() const
     // Temperature displays
     int tempY = y + (int)(200 * scale);
     char tempStr[32];
-    snprintf(tempStr, sizeof(tempStr), "%.1fC", m_data.engineTemp);
-    DrawTextEx(*m_font, tempStr, {(float)(x + 10), (float)tempY}, (int)(14 * scale), 1, WHITE);
+    textCache.Draw(*m_font, FormatFixed(tempStr, data.engineTemp, 1, "C"), {(float)(x + 10), (float)tempY}, (int)(14 * scale), 1, WHITE);
 
-    snprintf(tempStr, sizeof(tempStr), "%.1fC", m_data.oilTemp);
-    DrawTextEx(*m_font, tempStr, {(float)(x + 10), (float)(tempY + (int)(20 * scale))}, (int)(14 * scale), 1, WHITE);
+    textCache.Draw(*m_font, FormatFixed(tempStr, data.oilTemp, 1, "C"), {(float)(x + 10), (float)(tempY + (int)(20 * scale))}, (int)(14 * scale), 1, WHITE);
 
     // Lap times
     int lapY = y + (int)(210 * scale);
@@ -93,11 +114,11 @@ void SpeedometerOverlay::Render() const
     int lapHeight = (int)(25 * scale);
     
     DrawRectangle(x + (int)(60 * scale), lapY, lapWidth, lapHeight, Color{255, 0, 0, 200});
-    DrawTextEx(*m_font, m_data.lapTime.c_str(), {(float)(x + (int)(65 * scale)), (float)(lapY + 5)}, (int)(14 * scale), 1, WHITE);
+    textCache.Draw(*m_font, m_lapTimeText, {(float)(x + (int)(65 * scale)), (float)(lapY + 5)}, (int)(14 * scale), 1, WHITE);
 
     DrawRectangle(x + (int)(60 * scale), lapY + (int)(28 * scale), lapWidth, lapHeight, Color{100, 100, 200, 200});
-    DrawTextEx(*m_font, "NRG", {(float)(x + (int)(65 * scale)), (float)(lapY + (int)(32 * scale))}, (int)(12 * scale), 1, WHITE);
-    DrawTextEx(*m_font, m_data.lastLap.c_str(), {(float)(x + (int)(100 * scale)), (float)(lapY + (int)(32 * scale))}, (int)(12 * scale), 1, WHITE);
+    textCache.Draw(*m_font, "NRG", {(float)(x + (int)(65 * scale)), (float)(lapY + (int)(32 * scale))}, (int)(12 * scale), 1, WHITE);
+    textCache.Draw(*m_font, m_lastLapText, {(float)(x + (int)(100 * scale)), (float)(lapY + (int)(32 * scale))}, (int)(12 * scale), 1, WHITE);
 
     // Fuel and ERS bars
     int barX = centerX + (int)(80 * scale);
@@ -106,8 +127,8 @@ void SpeedometerOverlay::Render() const
 
     // Fuel bar
     DrawRectangle(barX, centerY - (int)(40 * scale), barWidth, barHeight, Color{60, 60, 60, 200});
-    int fuelFill = (int)(barHeight * (m_data.fuelPercent / 100.0f));
-    Color fuelColor = m_data.fuelPercent > 20 ? Color{255, 200, 0, 255} : Color{255, 0, 0, 255};
+    int fuelFill = (int)(barHeight * (data.fuelPercent / 100.0f));
+    Color fuelColor = data.fuelPercent > 20 ? Color{255, 200, 0, 255} : Color{255, 0, 0, 255};
     DrawRectangle(barX, centerY - (int)(40 * scale) + (barHeight - fuelFill), barWidth, fuelFill, fuelColor);
 
     // Battery indicator
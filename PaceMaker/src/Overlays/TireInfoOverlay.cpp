@@ -1,13 +1,21 @@
 #include <Overlays/TireInfoOverlay.h>
 
+#include <Utils/NumberFormat.h>
+#include <Utils/TextCache.h>
+
 #include <raylib.h>
 
 #include <algorithm>
-#include <cstdio>
 
 namespace pacemaker
 {
 //------------------------------------------------------------------------------
+// Scale of the tire layout for the available space
+static float LayoutScale(int width, int height)
+{
+    return std::min(width / 90.0f, height / 70.0f);
+}
+//------------------------------------------------------------------------------
 TireInfoOverlay::TireInfoOverlay(
     Bounds bounds,
     MinSize minSize,
@@ -15,24 +23,37 @@ TireInfoOverlay::TireInfoOverlay(
     DataBroker<TireInfoData>& broker
 )
     : BaseWidget("TireInfo", bounds, minSize)
+    , m_reader(broker)
     , m_font(font)
 {
-    m_subscriptionId = broker.Subscribe([this](const TireInfoData& data) {
-        OnDataUpdated(data);
-    });
+    // Wear and temperatures change a few times a second at most: redraw only then
+    EnableRenderCache();
 }
 //------------------------------------------------------------------------------
-void TireInfoOverlay::Render() const
+void TireInfoOverlay::Update([[maybe_unused]] float deltaTime)
+{
+    if (m_reader.Poll())
+        InvalidateRenderCache();
+}
+//------------------------------------------------------------------------------
+Bounds TireInfoOverlay::GetContentBounds() const
+{
+    // The background starts below the top edge and the rear tires reach past the bottom one
+    const auto& [x, y, width, height] = m_bounds;
+    const int tiresBottom = (int)(150 * LayoutScale(width, height)) + 1;
+    return Bounds{ x, y, width, std::max(height + 56, tiresBottom) };
+}
+//------------------------------------------------------------------------------
+void TireInfoOverlay::RenderContent() const
 {
-    if (!m_isVisible) return;
-
     const auto& [x, y, width, height] = m_bounds;
+    const auto& data = m_reader.Get();
 
     // Background
     DrawRectangle(x, y + 56, width, height, Color{30, 30, 40, 220});
 
     // Scale tire layout based on available space
-    float scale = std::min(width / 90.0f, height / 70.0f);
+    float scale = LayoutScale(width, height);
 
     int tireWidth = (int)(30 * scale);
     int tireHeight = (int)(50 * scale);
@@ -44,55 +65,52 @@ void TireInfoOverlay::Render() const
     int carHeight = (int)(80 * scale);
     DrawRectangleLines(carCenterX - carWidth / 2, topY + (int)(10 * scale), carWidth, carHeight, Color{100, 100, 100, 150});
 
+    auto& textCache = TextCache::Instance();
     char tempStr[16];
 
     // Front Left Tire
     int flX = carCenterX - (int)(40 * scale);
     int flY = topY;
     Color flColor = Color{
-        (unsigned char)(255 - m_data.wear[0] * 2.55f),
-        (unsigned char)(m_data.wear[0] * 2.55f),
+        (unsigned char)(255 - data.wear[0] * 2.55f),
+        (unsigned char)(data.wear[0] * 2.55f),
         0, 255
     };
     DrawRectangle(flX, flY, tireWidth, tireHeight, flColor);
-    snprintf(tempStr, sizeof(tempStr), "%.0f", m_data.temperatures[0]);
-    DrawTextEx(*m_font, tempStr, {(float)(flX + 5), (float)(flY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
+    textCache.Draw(*m_font, FormatFixed(tempStr, data.temperatures[0], 0), {(float)(flX + 5), (float)(flY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
 
     // Front Right Tire
     int frX = carCenterX + (int)(10 * scale);
     int frY = topY;
     Color frColor = Color{
-        (unsigned char)(255 - m_data.wear[1] * 2.55f),
-        (unsigned char)(m_data.wear[1] * 2.55f),
+        (unsigned char)(255 - data.wear[1] * 2.55f),
+        (unsigned char)(data.wear[1] * 2.55f),
         0, 255
     };
     DrawRectangle(frX, frY, tireWidth, tireHeight, frColor);
-    snprintf(tempStr, sizeof(tempStr), "%.0f", m_data.temperatures[1]);
-    DrawTextEx(*m_font, tempStr, {(float)(frX + 5), (float)(frY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
+    textCache.Draw(*m_font, FormatFixed(tempStr, data.temperatures[1], 0), {(float)(frX + 5), (float)(frY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
 
     // Rear Left Tire
     int rlX = carCenterX - (int)(40 * scale);
     int rlY = topY + (int)(60 * scale);
     Color rlColor = Color{
-        (unsigned char)(255 - m_data.wear[2] * 2.55f),
-        (unsigned char)(m_data.wear[2] * 2.55f),
+        (unsigned char)(255 - data.wear[2] * 2.55f),
+        (unsigned char)(data.wear[2] * 2.55f),
         0, 255
     };
     DrawRectangle(rlX, rlY, tireWidth, tireHeight, rlColor);
-    snprintf(tempStr, sizeof(tempStr), "%.0f", m_data.temperatures[2]);
-    DrawTextEx(*m_font, tempStr, {(float)(rlX + 5), (float)(rlY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
+    textCache.Draw(*m_font, FormatFixed(tempStr, data.temperatures[2], 0), {(float)(rlX + 5), (float)(rlY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
 
     // Rear Right Tire
     int rrX = carCenterX + (int)(10 * scale);
     int rrY = topY + (int)(60 * scale);
     Color rrColor = Color{
-        (unsigned char)(255 - m_data.wear[3] * 2.55f),
-        (unsigned char)(m_data.wear[3] * 2.55f),
+        (unsigned char)(255 - data.wear[3] * 2.55f),
+        (unsigned char)(data.wear[3] * 2.55f),
         0, 255
     };
     DrawRectangle(rrX, rrY, tireWidth, tireHeight, rrColor);
-    snprintf(tempStr, sizeof(tempStr), "%.0f", m_data.temperatures[3]);
-    DrawTextEx(*m_font, tempStr, {(float)(rrX + 5), (float)(rrY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
+    textCache.Draw(*m_font, FormatFixed(tempStr, data.temperatures[3], 0), {(float)(rrX + 5), (float)(rrY + (int)(15 * scale))}, (int)(12 * scale), 1, WHITE);
 }
 
 } // namespace pacemaker
\ No newline at end of file
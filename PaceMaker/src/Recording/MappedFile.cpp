@@ -0,0 +1,250 @@
+#include <Recording/MappedFile.h>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+//------------------------------------------------------------------------------
+bool MappedFile::Create(const std::filesystem::path& path, size_t capacity)
+{
+  Close();
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+    CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  m_file = file;
+#else
+  m_file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (m_file < 0)
+  {
+    return false;
+  }
+#endif
+
+  m_size = 0;
+  m_writable = true;
+  if (!Map(std::max<size_t>(capacity, 1)))
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool MappedFile::Open(const std::filesystem::path& path)
+{
+  Close();
+
+  std::error_code error;
+  const auto size = std::filesystem::file_size(path, error);
+  if (error || size == 0)
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  m_file = file;
+#else
+  m_file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (m_file < 0)
+  {
+    return false;
+  }
+#endif
+
+  m_writable = false;
+  if (!Map(static_cast<size_t>(size)))
+  {
+    Close();
+    return false;
+  }
+  m_size = m_capacity;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool MappedFile::Append(std::span<const std::byte> bytes)
+{
+  if (!IsOpen() || !m_writable)
+  {
+    return false;
+  }
+
+  if (bytes.size() > m_capacity - m_size)
+  {
+    const size_t step = std::max(bytes.size(), std::min(m_capacity, MAX_GROWTH_STEP));
+    Unmap();
+    if (!Map(m_capacity + step) && !Map(m_capacity))
+    {
+      return false;
+    }
+    if (bytes.size() > m_capacity - m_size)
+    {
+      return false;
+    }
+  }
+
+  std::memcpy(m_data + m_size, bytes.data(), bytes.size());
+  m_size += bytes.size();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool MappedFile::WriteAt(size_t offset, std::span<const std::byte> bytes)
+{
+  if (!IsOpen() || !m_writable || offset > m_size || bytes.size() > m_size - offset)
+  {
+    return false;
+  }
+  std::memcpy(m_data + offset, bytes.data(), bytes.size());
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void MappedFile::Flush()
+{
+  if (!IsOpen() || !m_writable || m_size == 0)
+  {
+    return;
+  }
+
+#ifdef _WIN32
+  FlushViewOfFile(m_data, m_size);
+#else
+  ::msync(m_data, m_size, MS_ASYNC);
+#endif
+}
+
+//------------------------------------------------------------------------------
+void MappedFile::Close()
+{
+  Unmap();
+
+#ifdef _WIN32
+  if (m_file)
+  {
+    if (m_writable)
+    {
+      // The mapping extended the file to its capacity, cut off the unused tail
+      LARGE_INTEGER size;
+      size.QuadPart = static_cast<LONGLONG>(m_size);
+      SetFilePointerEx(m_file, size, nullptr, FILE_BEGIN);
+      SetEndOfFile(m_file);
+    }
+    CloseHandle(m_file);
+    m_file = nullptr;
+  }
+#else
+  if (m_file >= 0)
+  {
+    if (m_writable)
+    {
+      // The mapping extended the file to its capacity, cut off the unused tail
+      (void)::ftruncate(m_file, static_cast<off_t>(m_size));
+    }
+    ::close(m_file);
+    m_file = -1;
+  }
+#endif
+
+  m_size = 0;
+  m_capacity = 0;
+  m_writable = false;
+}
+
+//------------------------------------------------------------------------------
+bool MappedFile::Map(size_t capacity)
+{
+#ifdef _WIN32
+  // Creating a writable mapping larger than the file extends the file
+  const auto size = static_cast<unsigned long long>(capacity);
+  HANDLE mapping = CreateFileMappingW(m_file, nullptr, m_writable ? PAGE_READWRITE : PAGE_READONLY,
+    static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xFFFFFFFFull), nullptr);
+  if (!mapping)
+  {
+    return false;
+  }
+
+  void* data = MapViewOfFile(mapping, m_writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, capacity);
+  if (!data)
+  {
+    CloseHandle(mapping);
+    return false;
+  }
+  m_mapping = mapping;
+#else
+#ifdef __linux__
+  // Reserve the blocks up front: writing through the mapping into a sparse file on a full disk raises SIGBUS instead
+  // of failing here. posix_fallocate() also extends the file to the capacity.
+  if (m_writable && ::posix_fallocate(m_file, 0, static_cast<off_t>(capacity)) != 0)
+  {
+    return false;
+  }
+#else
+  if (m_writable && ::ftruncate(m_file, static_cast<off_t>(capacity)) != 0)
+  {
+    return false;
+  }
+#endif
+
+  void* data = ::mmap(nullptr, capacity, m_writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, m_file, 0);
+  if (data == MAP_FAILED)
+  {
+    return false;
+  }
+#endif
+
+  m_data = static_cast<std::byte*>(data);
+  m_capacity = capacity;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void MappedFile::Unmap()
+{
+  if (!m_data)
+  {
+    return;
+  }
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_data);
+  CloseHandle(m_mapping);
+  m_mapping = nullptr;
+#else
+  ::munmap(m_data, m_capacity);
+#endif
+
+  m_data = nullptr;
+}
+
+} // namespace pacemaker
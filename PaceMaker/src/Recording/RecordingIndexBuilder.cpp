@@ -0,0 +1,76 @@
+#include <Recording/RecordingIndexBuilder.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+void RecordingIndexBuilder::Reset()
+{
+  m_index.strings.clear();
+  m_index.keyframes.clear();
+  m_index.laps.clear();
+  std::fill(std::begin(m_topicOffsets), std::end(m_topicOffsets), RECORDING_NO_OFFSET);
+  m_nextKeyframeNs = 0;
+  m_lapTime = NO_TIME;
+}
+
+//------------------------------------------------------------------------------
+void RecordingIndexBuilder::AddFrame(RecordingTopic topic, uint64_t offset, int64_t timestampNs)
+{
+  if (timestampNs >= m_nextKeyframeNs)
+  {
+    auto& keyframe = m_index.keyframes.emplace_back();
+    keyframe.timestampNs = timestampNs;
+    keyframe.offset = offset;
+    std::copy(std::begin(m_topicOffsets), std::end(m_topicOffsets), keyframe.topicOffsets);
+    m_nextKeyframeNs = timestampNs + RECORDING_KEYFRAME_INTERVAL_NS;
+  }
+
+  // Strings are all loaded up front from the index, so they never need restoring
+  const auto slot = static_cast<size_t>(topic);
+  if (topic != RecordingTopic::String && slot < RECORDING_TOPIC_COUNT)
+  {
+    m_topicOffsets[slot] = offset;
+  }
+}
+
+//------------------------------------------------------------------------------
+void RecordingIndexBuilder::AddString(StringId id, std::string_view text)
+{
+  auto& entry = m_index.strings.emplace_back();
+  entry.id = id;
+  entry.text.assign(text.begin(), text.end());
+}
+
+//------------------------------------------------------------------------------
+void RecordingIndexBuilder::AddVehicle(const VehicleData& vehicle, int64_t timestampNs)
+{
+  if (vehicle.lapTime == NO_TIME)
+  {
+    return;
+  }
+
+  const bool isFirstLap = m_index.laps.empty();
+  if (isFirstLap || vehicle.lapTime < m_lapTime)
+  {
+    auto& lap = m_index.laps.emplace_back();
+    lap.lap = static_cast<uint32_t>(m_index.laps.size());
+    lap.timestampNs = timestampNs;
+    lap.previousLapTime = isFirstLap ? NO_TIME : vehicle.lastLap;
+  }
+  m_lapTime = vehicle.lapTime;
+}
+
+//------------------------------------------------------------------------------
+RecordingIndex RecordingIndexBuilder::TakeIndex()
+{
+  RecordingIndex index = std::move(m_index);
+  Reset();
+  return index;
+}
+
+} // namespace pacemaker
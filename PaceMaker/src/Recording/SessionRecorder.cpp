@@ -0,0 +1,242 @@
+#include <Recording/SessionRecorder.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+SessionRecorder::~SessionRecorder()
+{
+  Stop();
+}
+
+//------------------------------------------------------------------------------
+bool SessionRecorder::Start(const std::filesystem::path& path, const Options& options)
+{
+  if (IsRecording() || !m_file.Create(path, std::max(options.initialCapacity, RECORDING_HEADER_SIZE)))
+  {
+    return false;
+  }
+
+  m_options = options;
+  m_startTime = Clock::now();
+  m_lastSubmit = m_startTime;
+
+  m_header = {};
+  std::copy(std::begin(RECORDING_MAGIC), std::end(RECORDING_MAGIC), m_header.magic);
+  m_header.headerSize = static_cast<uint32_t>(RECORDING_HEADER_SIZE);
+  m_header.startTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+  m_headerBytes.clear();
+  BinaryCodec::Encode(m_header, m_headerBytes);
+  (void)m_file.Append(m_headerBytes);
+
+  m_writeFailed = false;
+  m_stats = {};
+  m_stats.bytes = m_file.Size();
+
+  // The empty string is known to every session
+  m_stringsRecorded = EMPTY_STRING_ID + 1;
+  m_index.Reset();
+  m_batch.clear();
+  m_batch.reserve(m_options.batchBytes * 2);
+  m_batchOffset = m_file.Size();
+  m_batchFrames = 0;
+  m_batchEndNs = 0;
+  m_inbox.clear();
+  m_inbox.reserve(m_options.batchBytes * 2);
+
+  m_writer = std::jthread([this](std::stop_token stopToken) { WriterLoop(stopToken); });
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SessionRecorder::Stop()
+{
+  if (!IsRecording())
+  {
+    return;
+  }
+
+  for (auto& unsubscribe : m_subscriptions)
+  {
+    unsubscribe();
+  }
+  m_subscriptions.clear();
+
+  // Hand over whatever is left, appending to the inbox if the writer has not picked up the previous batch yet
+  if (!m_batch.empty())
+  {
+    std::lock_guard lock(m_mutex);
+    m_inbox.insert(m_inbox.end(), m_batch.begin(), m_batch.end());
+    m_inboxFrames += m_batchFrames;
+    m_inboxEndNs = std::max(m_inboxEndNs, m_batchEndNs);
+    ++m_stats.batches;
+  }
+  m_batch.clear();
+  m_batchFrames = 0;
+
+  // The writer drains the inbox before it honors the stop request
+  m_writer.request_stop();
+  m_writer.join();
+
+  WriteIndex();
+  m_file.Flush();
+  m_file.Close();
+}
+
+//------------------------------------------------------------------------------
+RecorderStats SessionRecorder::GetStats() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_stats;
+}
+
+//------------------------------------------------------------------------------
+void SessionRecorder::AppendNewStrings(Clock::time_point now)
+{
+  // Strings are interned rarely, so this is normally a single atomic load
+  const auto& strings = StringTable::Instance();
+  const size_t count = strings.Size();
+  while (m_stringsRecorded < count)
+  {
+    const auto id = static_cast<StringId>(m_stringsRecorded++);
+    const std::string_view text = strings.View(id);
+    m_stringEntry.id = id;
+    m_stringEntry.text.assign(text.begin(), text.end());
+    m_index.AddString(id, text);
+
+    AppendFrameHeader(RecordingTopic::String, BinaryCodec::EncodedSize(m_stringEntry), now);
+    BinaryCodec::Encode(m_stringEntry, m_batch);
+  }
+}
+
+//------------------------------------------------------------------------------
+int64_t SessionRecorder::AppendFrameHeader(RecordingTopic topic, size_t payloadSize, Clock::time_point now)
+{
+  const int64_t timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_startTime).count();
+  m_index.AddFrame(topic, m_batchOffset + m_batch.size(), timestampNs);
+
+  const RecordingFrameHeader header{
+    .payloadSize = static_cast<uint32_t>(payloadSize),
+    .topic = topic,
+    .timestampNs = timestampNs,
+  };
+  BinaryCodec::Encode(header, m_batch);
+  ++m_batchFrames;
+  m_batchEndNs = timestampNs;
+  return timestampNs;
+}
+
+//------------------------------------------------------------------------------
+void SessionRecorder::SubmitIfDue(Clock::time_point now)
+{
+  if (m_batch.size() < m_options.batchBytes && now - m_lastSubmit < m_options.flushInterval)
+  {
+    return;
+  }
+
+  // Never wait for the writer; if it is still busy with the previous batch, keep batching
+  std::unique_lock lock(m_mutex, std::try_to_lock);
+  if (!lock.owns_lock() || !m_inbox.empty())
+  {
+    return;
+  }
+
+  m_batchOffset += m_batch.size();
+  std::swap(m_inbox, m_batch);
+  m_inboxFrames = m_batchFrames;
+  m_inboxEndNs = m_batchEndNs;
+  ++m_stats.batches;
+  lock.unlock();
+  m_wake.notify_one();
+
+  m_batchFrames = 0;
+  m_lastSubmit = now;
+}
+
+//------------------------------------------------------------------------------
+void SessionRecorder::WriterLoop(std::stop_token stopToken)
+{
+  // Three buffers circulate between batching, inbox and writing, so steady-state recording does not allocate
+  std::vector<std::byte> batch;
+  batch.reserve(m_options.batchBytes * 2);
+
+  while (true)
+  {
+    uint64_t frames = 0;
+    int64_t lastTimestampNs = 0;
+    {
+      std::unique_lock lock(m_mutex);
+      m_wake.wait(lock, stopToken, [this]() { return !m_inbox.empty(); });
+      if (m_inbox.empty())
+      {
+        return; // Stop requested and nothing left to write
+      }
+
+      std::swap(batch, m_inbox);
+      frames = m_inboxFrames;
+      lastTimestampNs = m_inboxEndNs;
+      m_inboxFrames = 0;
+    }
+
+    WriteBatch(batch, frames, lastTimestampNs);
+    batch.clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+void SessionRecorder::WriteBatch(std::span<const std::byte> batch, uint64_t frames, int64_t lastTimestampNs)
+{
+  // A failed batch may have held string frames later frames refer to, so nothing after it is written
+  if (m_writeFailed || !m_file.Append(batch))
+  {
+    m_writeFailed = true;
+    std::lock_guard lock(m_mutex);
+    m_stats.failed = true;
+    return;
+  }
+
+  // Keep the header current so a recording cut short by a crash is still readable up to this batch
+  m_header.frameCount += frames;
+  m_header.dataSize = m_file.Size() - RECORDING_HEADER_SIZE;
+  m_header.durationNs = lastTimestampNs;
+  m_headerBytes.clear();
+  BinaryCodec::Encode(m_header, m_headerBytes);
+  (void)m_file.WriteAt(0, m_headerBytes);
+
+  std::lock_guard lock(m_mutex);
+  m_stats.frames = m_header.frameCount;
+  m_stats.bytes = m_file.Size();
+}
+
+//------------------------------------------------------------------------------
+void SessionRecorder::WriteIndex()
+{
+  if (m_writeFailed)
+  {
+    return;
+  }
+
+  // Written behind the frames; the header only points at it once it is complete
+  std::vector<std::byte> indexBytes;
+  BinaryCodec::Encode(m_index.Index(), indexBytes);
+  const uint64_t indexOffset = m_file.Size();
+  if (!m_file.Append(indexBytes))
+  {
+    return;
+  }
+
+  m_header.indexOffset = indexOffset;
+  m_header.indexSize = indexBytes.size();
+  m_headerBytes.clear();
+  BinaryCodec::Encode(m_header, m_headerBytes);
+  (void)m_file.WriteAt(0, m_headerBytes);
+
+  std::lock_guard lock(m_mutex);
+  m_stats.bytes = m_file.Size();
+}
+
+} // namespace pacemaker
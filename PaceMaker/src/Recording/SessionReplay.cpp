@@ -0,0 +1,265 @@
+#include <Recording/SessionReplay.h>
+#include <Recording/RecordingIndexBuilder.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+bool SessionReplay::Open(const std::filesystem::path& path)
+{
+  Close();
+  if (!m_file.Open(path))
+  {
+    return false;
+  }
+
+  const auto bytes = m_file.Data();
+  const bool isValid = BinaryCodec::Decode(bytes, m_header) == RECORDING_HEADER_SIZE
+    && std::equal(std::begin(RECORDING_MAGIC), std::end(RECORDING_MAGIC), m_header.magic)
+    && m_header.version == RECORDING_VERSION
+    && m_header.headerSize == RECORDING_HEADER_SIZE
+    && m_header.dataSize <= bytes.size() - RECORDING_HEADER_SIZE;
+  if (!isValid)
+  {
+    Close();
+    return false;
+  }
+
+  m_dataBegin = m_header.headerSize;
+  m_dataEnd = m_dataBegin + m_header.dataSize;
+
+  const bool hasIndex = m_header.indexSize > 0
+    && m_header.indexOffset >= m_dataEnd
+    && m_header.indexSize <= bytes.size() - m_header.indexOffset
+    && BinaryCodec::Decode(bytes.subspan(m_header.indexOffset, m_header.indexSize), m_index) == m_header.indexSize;
+  if (!hasIndex)
+  {
+    RebuildIndex();
+  }
+
+  InternStrings();
+  m_cursor = m_dataBegin;
+  m_position = 0;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::Close()
+{
+  m_file.Close();
+  m_header = {};
+  m_index = {};
+  m_strings.Clear();
+  m_dataBegin = 0;
+  m_dataEnd = 0;
+  m_cursor = 0;
+  m_position = 0;
+  for (auto& channel : m_channels)
+  {
+    channel.pendingOffset = RECORDING_NO_OFFSET;
+    channel.streamCounter = 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::Seek(int64_t timestampNs)
+{
+  if (!IsOpen())
+  {
+    return;
+  }
+
+  timestampNs = std::clamp<int64_t>(timestampNs, 0, GetDuration());
+
+  // Latest keyframe at or before the target; its offsets restore every topic, the frames after it catch up
+  const auto& keyframes = m_index.keyframes;
+  auto it = std::upper_bound(keyframes.begin(), keyframes.end(), timestampNs,
+    [](int64_t time, const RecordingKeyframe& keyframe) { return time < keyframe.timestampNs; });
+
+  if (it == keyframes.begin())
+  {
+    m_cursor = m_dataBegin;
+    for (auto& channel : m_channels)
+    {
+      channel.pendingOffset = RECORDING_NO_OFFSET;
+    }
+  }
+  else
+  {
+    const RecordingKeyframe& keyframe = *std::prev(it);
+    m_cursor = keyframe.offset;
+    for (size_t i = 0; i < m_channels.size(); ++i)
+    {
+      m_channels[i].pendingOffset = keyframe.topicOffsets[i];
+    }
+  }
+
+  PlayUntil(timestampNs, true);
+  m_position = timestampNs;
+}
+
+//------------------------------------------------------------------------------
+bool SessionReplay::SeekToLap(uint32_t lap)
+{
+  const auto& laps = m_index.laps;
+  auto it = std::lower_bound(laps.begin(), laps.end(), lap,
+    [](const RecordingLap& entry, uint32_t value) { return entry.lap < value; });
+  if (it == laps.end() || it->lap != lap)
+  {
+    return false;
+  }
+
+  Seek(it->timestampNs);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::Advance(Clock::duration elapsed)
+{
+  if (!IsOpen() || m_paused || IsFinished())
+  {
+    return;
+  }
+
+  const double elapsedNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  const int64_t target = std::min(GetDuration(), m_position + static_cast<int64_t>(elapsedNs * m_speed));
+  PlayUntil(target, false);
+  m_position = target;
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::SetSpeed(double speed)
+{
+  m_speed = std::clamp(speed, MIN_SPEED, MAX_SPEED);
+
+  // At n x speed a stream still arrives at its recorded rate, so the overlays see the same number of samples per second
+  m_streamStride = std::max<uint64_t>(1, static_cast<uint64_t>(std::floor(m_speed)));
+}
+
+//------------------------------------------------------------------------------
+bool SessionReplay::ReadFrame(uint64_t offset, RecordingFrameHeader& header, std::span<const std::byte>& payload) const
+{
+  if (offset >= m_dataEnd || m_dataEnd - offset < RECORDING_FRAME_HEADER_SIZE)
+  {
+    return false;
+  }
+
+  const auto frame = m_file.Data().subspan(offset, m_dataEnd - offset);
+  if (BinaryCodec::Decode(frame, header) != RECORDING_FRAME_HEADER_SIZE
+    || header.payloadSize > frame.size() - RECORDING_FRAME_HEADER_SIZE)
+  {
+    return false;
+  }
+
+  payload = frame.subspan(RECORDING_FRAME_HEADER_SIZE, header.payloadSize);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::PlayUntil(int64_t timestampNs, bool collapseStreams)
+{
+  RecordingFrameHeader header;
+  std::span<const std::byte> payload;
+
+  // Only frame headers are read while walking; payloads are decoded for the frames actually published
+  while (ReadFrame(m_cursor, header, payload))
+  {
+    if (header.timestampNs > timestampNs)
+    {
+      break;
+    }
+
+    const auto slot = static_cast<size_t>(header.topic);
+    if (slot < m_channels.size() && m_channels[slot].publish)
+    {
+      Channel& channel = m_channels[slot];
+      if (channel.policy == ReplayPolicy::Stream && !collapseStreams)
+      {
+        if (channel.streamCounter++ % m_streamStride == 0)
+        {
+          channel.publish(payload);
+        }
+      }
+      else
+      {
+        channel.pendingOffset = m_cursor;
+      }
+    }
+
+    m_cursor += RECORDING_FRAME_HEADER_SIZE + header.payloadSize;
+  }
+
+  // A frame that does not parse ends the recording
+  if (m_cursor < m_dataEnd && !ReadFrame(m_cursor, header, payload))
+  {
+    m_cursor = m_dataEnd;
+  }
+
+  PublishPending();
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::PublishPending()
+{
+  RecordingFrameHeader header;
+  std::span<const std::byte> payload;
+
+  for (auto& channel : m_channels)
+  {
+    if (channel.pendingOffset != RECORDING_NO_OFFSET && channel.publish && ReadFrame(channel.pendingOffset, header, payload))
+    {
+      channel.publish(payload);
+    }
+    channel.pendingOffset = RECORDING_NO_OFFSET;
+  }
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::RebuildIndex()
+{
+  RecordingIndexBuilder builder;
+  RecordingFrameHeader header;
+  RecordingStringEntry entry;
+  VehicleData vehicle;
+  std::span<const std::byte> payload;
+
+  uint64_t offset = m_dataBegin;
+  int64_t lastTimestampNs = 0;
+  while (ReadFrame(offset, header, payload))
+  {
+    builder.AddFrame(header.topic, offset, header.timestampNs);
+    lastTimestampNs = header.timestampNs;
+    if (header.topic == RecordingTopic::String && BinaryCodec::Decode(payload, entry) != 0)
+    {
+      builder.AddString(entry.id, std::string_view(entry.text.data(), entry.text.size()));
+    }
+    else if (header.topic == RecordingTopic::Vehicle && BinaryCodec::Decode(payload, vehicle) != 0)
+    {
+      builder.AddVehicle(vehicle, header.timestampNs);
+    }
+    offset += RECORDING_FRAME_HEADER_SIZE + header.payloadSize;
+  }
+
+  // Whatever follows the last readable frame was cut off
+  m_dataEnd = offset;
+  m_header.durationNs = lastTimestampNs;
+  m_index = builder.TakeIndex();
+}
+
+//------------------------------------------------------------------------------
+void SessionReplay::InternStrings()
+{
+  // Replaying into a fresh string table hands out the recorded ids again, so payloads need no rewriting
+  auto& strings = StringTable::Instance();
+  for (const auto& entry : m_index.strings)
+  {
+    m_strings.Set(entry.id, strings.Intern(std::string_view(entry.text.data(), entry.text.size())));
+  }
+}
+
+} // namespace pacemaker
@@ -0,0 +1,59 @@
+#include <Sources/ReplaySource.h>
+
+#include <cstdio>
+#include <utility>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+ReplaySource::ReplaySource(Options options)
+  : m_options(std::move(options))
+{
+}
+
+//------------------------------------------------------------------------------
+bool ReplaySource::Open(TelemetrySinks& sinks)
+{
+  if (!m_replay.Open(m_options.path))
+  {
+    return false;
+  }
+
+  m_replay.Attach(sinks.leaderboard, RecordingTopic::Leaderboard);
+  m_replay.Attach(sinks.relativeTiming, RecordingTopic::RelativeTiming);
+  m_replay.Attach(sinks.tireInfo, RecordingTopic::TireInfo);
+  m_replay.Attach(sinks.vehicle, RecordingTopic::Vehicle);
+  m_replay.Attach(sinks.inputTelemetry, RecordingTopic::InputTelemetry, ReplayPolicy::Stream);
+  m_replay.SetSpeed(m_options.speed);
+
+  if (m_options.lap == 0 || !m_replay.SeekToLap(m_options.lap))
+  {
+    m_replay.Seek(0);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void ReplaySource::Poll(std::chrono::steady_clock::duration elapsed)
+{
+  m_replay.Advance(elapsed);
+}
+
+//------------------------------------------------------------------------------
+void ReplaySource::Close()
+{
+  m_replay.Close();
+}
+
+//------------------------------------------------------------------------------
+std::string ReplaySource::GetStatus() const
+{
+  char status[128];
+  snprintf(status, sizeof(status), "position: %.1f s of %.1f s, %zu laps%s",
+    m_replay.GetPosition() / 1e9, m_replay.GetDuration() / 1e9, m_replay.GetLaps().size(),
+    m_replay.IsFinished() ? ", finished" : "");
+  return status;
+}
+
+} // namespace pacemaker
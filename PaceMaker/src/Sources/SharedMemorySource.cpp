@@ -0,0 +1,51 @@
+#include <Sources/SharedMemorySource.h>
+
+#include <cstdio>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+SharedMemorySource::SharedMemorySource(const SharedTelemetryReader::Options& options)
+  : m_options(options)
+{
+}
+
+//------------------------------------------------------------------------------
+bool SharedMemorySource::Open(TelemetrySinks& sinks)
+{
+  m_reader.Attach(sinks.leaderboard, PacketType::Leaderboard);
+  m_reader.Attach(sinks.relativeTiming, PacketType::RelativeTiming);
+  m_reader.Attach(sinks.tireInfo, PacketType::TireInfo);
+  m_reader.Attach(sinks.vehicle, PacketType::Vehicle);
+  m_reader.Attach(sinks.inputTelemetry, PacketType::InputTelemetry);
+  return m_reader.Open(m_options);
+}
+
+//------------------------------------------------------------------------------
+IngestTask SharedMemorySource::Ingest(IngestExecutor& executor)
+{
+  return m_reader.Ingest(executor);
+}
+
+//------------------------------------------------------------------------------
+void SharedMemorySource::Close()
+{
+  m_reader.Close();
+}
+
+//------------------------------------------------------------------------------
+std::string SharedMemorySource::GetStatus() const
+{
+  const SharedReaderStats stats = m_reader.GetStats();
+  char status[192];
+  snprintf(status, sizeof(status), "region: %s, frames: %llu, torn: %llu, malformed: %llu, polls: %llu",
+    m_options.name.c_str(),
+    static_cast<unsigned long long>(stats.frames),
+    static_cast<unsigned long long>(stats.torn),
+    static_cast<unsigned long long>(stats.malformed),
+    static_cast<unsigned long long>(stats.polls));
+  return status;
+}
+
+} // namespace pacemaker
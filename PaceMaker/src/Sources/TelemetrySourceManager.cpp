@@ -0,0 +1,190 @@
+#include <Sources/TelemetrySourceManager.h>
+#include <Sources/ReplaySource.h>
+#include <Sources/SharedMemorySource.h>
+#include <Sources/TestDataSource.h>
+#include <Sources/UdpSource.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+TelemetrySourceManager::TelemetrySourceManager(const TelemetrySinks& sinks)
+  : m_sinks(sinks)
+{
+}
+
+//------------------------------------------------------------------------------
+TelemetrySourceManager::~TelemetrySourceManager()
+{
+  Stop();
+}
+
+//------------------------------------------------------------------------------
+size_t TelemetrySourceManager::Start(std::vector<std::unique_ptr<ITelemetrySource>> sources)
+{
+  Stop();
+  for (auto& source : sources)
+  {
+    if (source && source->Open(m_sinks))
+    {
+      m_sources.push_back(std::move(source));
+    }
+  }
+  if (m_sources.empty())
+  {
+    return 0;
+  }
+
+  m_throttledPolls = 0;
+  for (const auto& source : m_sources)
+  {
+    m_executor.Spawn(source->GetMode() == SourceMode::Async ? source->Ingest(m_executor) : PollSource(*source));
+  }
+  m_worker = std::jthread([this](std::stop_token stopToken) { m_executor.Run(stopToken); });
+  return m_sources.size();
+}
+
+//------------------------------------------------------------------------------
+bool TelemetrySourceManager::Start(std::unique_ptr<ITelemetrySource> source)
+{
+  std::vector<std::unique_ptr<ITelemetrySource>> sources;
+  sources.push_back(std::move(source));
+  return Start(std::move(sources)) == 1;
+}
+
+//------------------------------------------------------------------------------
+void TelemetrySourceManager::Stop()
+{
+  if (m_worker.joinable())
+  {
+    m_worker.request_stop();
+    m_worker.join();
+  }
+  if (m_sources.empty())
+  {
+    return;
+  }
+
+  m_lastStatus.clear();
+  for (const auto& source : m_sources)
+  {
+    m_lastStatus += m_lastStatus.empty() ? "" : ", ";
+    m_lastStatus += source->GetName();
+    m_lastStatus += " (" + source->GetStatus() + ")";
+    source->Close();
+  }
+  m_sources.clear();
+}
+
+//------------------------------------------------------------------------------
+std::string TelemetrySourceManager::GetSourceNames() const
+{
+  if (m_sources.empty())
+  {
+    return "none";
+  }
+
+  std::string names;
+  for (const auto& source : m_sources)
+  {
+    names += names.empty() ? "" : "+";
+    names += source->GetName();
+  }
+  return names;
+}
+
+//------------------------------------------------------------------------------
+IngestTask TelemetrySourceManager::PollSource(ITelemetrySource& source)
+{
+  using Clock = IngestExecutor::Clock;
+  const auto interval = std::chrono::duration_cast<Clock::duration>(source.GetPollInterval());
+
+  auto previousPoll = Clock::now();
+  auto nextPoll = previousPoll;
+  while (true)
+  {
+    const auto now = Clock::now();
+    if (m_sinks.IsSaturated())
+    {
+      // Backpressure: time spent waiting for the render thread to catch up is not handed to the source
+      m_throttledPolls.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      source.Poll(now - previousPoll);
+    }
+    previousPoll = now;
+
+    nextPoll += interval;
+    if (nextPoll < now)
+    {
+      nextPoll = now; // Fell behind, e.g. after a debugger break; do not try to catch up tick by tick
+    }
+    co_await m_executor.SleepUntil(nextPoll);
+  }
+}
+
+//------------------------------------------------------------------------------
+std::unique_ptr<ITelemetrySource> CreateTelemetrySource(std::string_view name, const Config& config)
+{
+  if (name == "generator")
+  {
+    return std::make_unique<TestDataSource>();
+  }
+  if (name == "udp")
+  {
+    UdpTelemetryReceiver::Options options;
+    options.bindAddress = config.GetString("udp.bind", options.bindAddress);
+    options.port = static_cast<uint16_t>(config.GetInt("udp.port", options.port));
+    return std::make_unique<UdpSource>(options);
+  }
+  if (name == "shm")
+  {
+    SharedTelemetryReader::Options options;
+    options.name = config.GetString("shm.name", options.name);
+    return std::make_unique<SharedMemorySource>(options);
+  }
+  if (name == "replay")
+  {
+    ReplaySource::Options options;
+    options.path = config.GetString("replay.path", "session.pmrec");
+    options.speed = config.GetDouble("replay.speed", options.speed);
+    options.lap = static_cast<uint32_t>(config.GetInt("replay.lap", 0));
+    return std::make_unique<ReplaySource>(std::move(options));
+  }
+  return nullptr;
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::unique_ptr<ITelemetrySource>> CreateTelemetrySources(const Config& config)
+{
+  const std::string list = config.GetString("source", "generator");
+  std::vector<std::unique_ptr<ITelemetrySource>> sources;
+
+  size_t begin = 0;
+  while (begin <= list.size())
+  {
+    const size_t end = std::min(list.find(',', begin), list.size());
+    std::string_view name(list.data() + begin, end - begin);
+    while (!name.empty() && name.front() == ' ')
+    {
+      name.remove_prefix(1);
+    }
+    while (!name.empty() && name.back() == ' ')
+    {
+      name.remove_suffix(1);
+    }
+
+    if (auto source = CreateTelemetrySource(name, config))
+    {
+      sources.push_back(std::move(source));
+    }
+    begin = end + 1;
+  }
+  return sources;
+}
+
+} // namespace pacemaker
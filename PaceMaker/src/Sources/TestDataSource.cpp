@@ -0,0 +1,51 @@
+#include <Sources/TestDataSource.h>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+bool TestDataSource::Open(TelemetrySinks& sinks)
+{
+  m_sinks = &sinks;
+  m_time = 0.0;
+  m_ticks = 0;
+
+  // The leaderboard is sent whole once, afterwards only the rows that changed
+  m_sinks->leaderboard.Publish(m_generator.GetLeaderboardData());
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void TestDataSource::Poll(std::chrono::steady_clock::duration elapsed)
+{
+  m_time += std::chrono::duration<double>(elapsed).count();
+  const auto time = static_cast<float>(m_time);
+
+  m_generator.UpdateInputTelemetryData(time);
+  m_generator.UpdateLeaderboardData(time);
+  m_generator.UpdateVehicleData(time);
+  m_generator.UpdateTireData(time);
+  m_generator.UpdateRelativeTimingData(time);
+
+  // Publish at sim rate; each subscription throttles its own delivery rate
+  m_sinks->inputTelemetry.Publish(m_generator.GetInputTelemetryData());
+  m_sinks->leaderboard.PublishDelta(m_generator.GetLeaderboardDelta());
+  m_sinks->relativeTiming.Publish(m_generator.GetRelativeTimingData());
+  m_sinks->tireInfo.Publish(m_generator.GetTireData());
+  m_sinks->vehicle.Publish(m_generator.GetVehicleData());
+  ++m_ticks;
+}
+
+//------------------------------------------------------------------------------
+void TestDataSource::Close()
+{
+  m_sinks = nullptr;
+}
+
+//------------------------------------------------------------------------------
+std::string TestDataSource::GetStatus() const
+{
+  return "ticks: " + std::to_string(m_ticks);
+}
+
+} // namespace pacemaker
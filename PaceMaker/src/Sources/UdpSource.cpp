@@ -0,0 +1,54 @@
+#include <Sources/UdpSource.h>
+
+#include <cstdio>
+
+namespace pacemaker
+{
+
+//------------------------------------------------------------------------------
+UdpSource::UdpSource(const UdpTelemetryReceiver::Options& options)
+  : m_options(options)
+{
+}
+
+//------------------------------------------------------------------------------
+bool UdpSource::Open(TelemetrySinks& sinks)
+{
+  m_receiver.Attach(sinks.leaderboard, PacketType::Leaderboard);
+  m_receiver.Attach(sinks.relativeTiming, PacketType::RelativeTiming);
+  m_receiver.Attach(sinks.tireInfo, PacketType::TireInfo);
+  m_receiver.Attach(sinks.vehicle, PacketType::Vehicle);
+  m_receiver.Attach(sinks.inputTelemetry, PacketType::InputTelemetry);
+  return m_receiver.Open(m_options);
+}
+
+//------------------------------------------------------------------------------
+IngestTask UdpSource::Ingest(IngestExecutor& executor)
+{
+  return m_receiver.Ingest(executor);
+}
+
+//------------------------------------------------------------------------------
+void UdpSource::Close()
+{
+  m_receiver.Close();
+}
+
+//------------------------------------------------------------------------------
+std::string UdpSource::GetStatus() const
+{
+  const ReceiverStats stats = m_receiver.GetStats();
+  char status[224];
+  snprintf(status, sizeof(status), "port: %u (%s), packets: %llu, bytes: %llu, batches: %llu, malformed: %llu, lost: %llu, stale: %llu",
+    static_cast<unsigned>(m_options.port),
+    m_receiver.IsUsingIoUring() ? "io_uring" : "recvmmsg",
+    static_cast<unsigned long long>(stats.packets),
+    static_cast<unsigned long long>(stats.bytes),
+    static_cast<unsigned long long>(stats.batches),
+    static_cast<unsigned long long>(stats.malformed),
+    static_cast<unsigned long long>(stats.lost),
+    static_cast<unsigned long long>(stats.stale));
+  return status;
+}
+
+} // namespace pacemaker
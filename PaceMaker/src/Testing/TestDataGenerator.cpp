@@ -1,14 +1,23 @@
 #include <Testing/TestDataGenerator.h>
+#include <Data/StringTable.h>
 #include <cmath>
 #include <algorithm>
+#include <cstdio>
+#include <string_view>
 
 namespace pacemaker
 {
 
+// Names and codes are interned once per session, telemetry only carries their ids
+static StringId Intern(std::string_view text)
+{
+  return StringTable::Instance().Intern(text);
+}
+
 //------------------------------------------------------------------------------
-TestDataGenerator::TestDataGenerator()
+TestDataGenerator::TestDataGenerator(int carCount)
 {
-  InitializeLeaderboardData();
+  InitializeLeaderboardData(std::clamp(carCount, 1, MAX_CAR_COUNT));
   InitializeRelativeTimingData();
   InitializeTireData();
   InitializeVehicleData();
@@ -16,35 +25,64 @@ TestDataGenerator::TestDataGenerator()
 }
 
 //------------------------------------------------------------------------------
-void TestDataGenerator::InitializeLeaderboardData()
+void TestDataGenerator::InitializeLeaderboardData(int carCount)
 {
-  m_leaderboardData.sessionType = "Practice";
-  m_leaderboardData.sessionTime = "1:09:45";
+  m_leaderboardData.sessionType = Intern("Practice");
+  m_leaderboardData.sessionTime = ((1 * 60 + 9) * 60 + 45) * 1000; // 1:09:45
   m_leaderboardData.players = {
-      {1, 38, "O Rasmussen", "2:06.358", "", "", 0, 15, false},
-      {2, 51, "A P Guidi", "-", "", "", 1, 96, false},
-      {3, 35, "P Chatin", "-", "", "", 3, 18, false},
-      {4, 83, "R Kubica", "-", "", "", 1, 19, false},
-      {5, 11, "J Munro", "-", "", "", 9, 99, false},
-      {6, 36, "N Lapierre", "-", "", "", 3, 99, false},
-      {7, 8,  "S Buemi", "-", "", "", 2, 25, false},
-      {8, 5,  "M Campbell", "PIT", "", "", 0, 0, true}
+      {1, 38, Intern("O Rasmussen"), 126358, NO_TIME, NO_TIME, 0, 15, false},
+      {2, 51, Intern("A P Guidi"), NO_TIME, NO_TIME, NO_TIME, 1, 96, false},
+      {3, 35, Intern("P Chatin"), NO_TIME, NO_TIME, NO_TIME, 3, 18, false},
+      {4, 83, Intern("R Kubica"), NO_TIME, NO_TIME, NO_TIME, 1, 19, false},
+      {5, 11, Intern("J Munro"), NO_TIME, NO_TIME, NO_TIME, 9, 99, false},
+      {6, 36, Intern("N Lapierre"), NO_TIME, NO_TIME, NO_TIME, 3, 99, false},
+      {7, 8,  Intern("S Buemi"), NO_TIME, NO_TIME, NO_TIME, 2, 25, false},
+      {8, 5,  Intern("M Campbell"), NO_TIME, NO_TIME, NO_TIME, 0, 0, true}
   };
+
+  auto& players = m_leaderboardData.players;
+  if (carCount < static_cast<int>(players.size()))
+  {
+    players.resize(carCount);
+  }
+  for (int position = static_cast<int>(players.size()) + 1; position <= carCount; ++position)
+  {
+    const int number = FIRST_GENERATED_NUMBER + position;
+    char name[16];
+    std::snprintf(name, sizeof(name), "Car %d", number);
+    players.push_back({ position, number, Intern(name), NO_TIME, NO_TIME, NO_TIME, position % 10, 50, false });
+  }
+  m_leaderboardDelta.patches.reserve(players.size() * 2);
 }
 
 //------------------------------------------------------------------------------
 void TestDataGenerator::InitializeRelativeTimingData()
 {
-  m_relativeTimingData.playerPosition = 12;
-  m_relativeTimingData.players = {
-      {7, 7, "S Vandoorne", "HY", -18.8f, 0},
-      {13, 13, "F Heriau", "BR3", -7.0f, 2},
-      {1, 1, "O Rasmussen", "HY", -1.7f, 0},
-      {12, 12, "J Munro", "HY", 0.0f, 9},
-      {7, 7, "C Schiavoni", "BR3", 4.6f, 2},
-      {14, 14, "J Caygill", "BR3", 14.2f, 2},
-      {8, 8, "A A Harthy", "BR3", 14.8f, 2}
-  };
+  // The leaderboard's cars spread around the lap in race order, the leader furthest round; each laps a little slower
+  // than the one ahead, so the leaders catch the back markers and cars cross the line all the time
+  const auto& players = m_leaderboardData.players;
+  const float carCount = static_cast<float>(players.size());
+  m_trackStates.clear();
+  m_startDistances.clear();
+  m_playerIndex = players.size() - 1;
+  for (const PlayerData& player : players)
+  {
+    const float lapSeconds = LAP_TIME / 1000.0f * (1.0f + 0.004f * static_cast<float>(player.position - 1));
+    CarTrackState state;
+    state.position = player.position;
+    state.number = player.number;
+    state.name = player.name;
+    state.teamCode = Intern(player.teamColorIndex % 2 == 0 ? "HY" : "BR3");
+    state.teamColorIndex = player.teamColorIndex;
+    state.speed = TRACK_LENGTH / lapSeconds;
+    if (player.number == PLAYER_NUMBER)
+    {
+      m_playerIndex = m_trackStates.size();
+    }
+    m_trackStates.push_back(state);
+    m_startDistances.push_back(1.0f - static_cast<float>(player.position) / (carCount + 1.0f));
+  }
+  UpdateRelativeTimingData(0.0f);
 }
 
 //------------------------------------------------------------------------------
@@ -75,8 +113,8 @@ void TestDataGenerator::InitializeVehicleData()
   m_vehicleData.fuelPercent = 75.0f;
   m_vehicleData.ersPercent = 98.6f;
   m_vehicleData.drsEnabled = false;
-  m_vehicleData.lapTime = "88.71 (26.4 laps)";
-  m_vehicleData.lastLap = "98.6% (25.0 laps)";
+  m_vehicleData.lapTime = INITIAL_LAP_TIME;
+  m_vehicleData.lastLap = 98600;
 }
 
 //------------------------------------------------------------------------------
@@ -92,13 +130,38 @@ void TestDataGenerator::InitializeInputTelemetryData()
 //------------------------------------------------------------------------------
 void TestDataGenerator::UpdateLeaderboardData(float time)
 {
-  // Simulate battery changes for leaderboard
+  m_leaderboardDelta.Clear();
+
+  // Simulate battery changes for leaderboard, recording a patch for every row that changed
   for (auto& player : m_leaderboardData.players)
   {
     if (!player.inPit)
     {
-      player.batteryPercent = 50 + (int)(30 * std::sin(time * 0.5f + player.number));
-      player.batteryPercent = std::clamp(player.batteryPercent, 0, 100);
+      int batteryPercent = 50 + (int)(30 * std::sin(time * 0.5f + player.number));
+      batteryPercent = std::clamp(batteryPercent, 0, 100);
+      if (batteryPercent != player.batteryPercent)
+      {
+        player.batteryPercent = batteryPercent;
+
+        RowPatch patch{ player.number, ROW_FIELD_BATTERY, {} };
+        patch.values.batteryPercent = batteryPercent;
+        m_leaderboardDelta.patches.push_back(patch);
+      }
+    }
+
+    // Generated cars close in and drop back on the car ahead, so a large field changes on every update
+    if (player.number > FIRST_GENERATED_NUMBER)
+    {
+      const auto swing = static_cast<TimeMs>(400.0f * std::sin(time * 0.3f + player.number));
+      const TimeMs gap = (player.position - 1) * 1500 + swing;
+      if (gap != player.gap)
+      {
+        player.gap = gap;
+
+        RowPatch patch{ player.number, ROW_FIELD_GAP, {} };
+        patch.values.gap = gap;
+        m_leaderboardDelta.patches.push_back(patch);
+      }
     }
   }
 }
@@ -106,8 +169,13 @@ void TestDataGenerator::UpdateLeaderboardData(float time)
 //------------------------------------------------------------------------------
 void TestDataGenerator::UpdateRelativeTimingData(float time)
 {
-  // Could add dynamic gap changes here in the future
-  // For now, data remains static after initialization
+  for (size_t i = 0; i < m_trackStates.size(); ++i)
+  {
+    CarTrackState& state = m_trackStates[i];
+    const float laps = m_startDistances[i] + time * state.speed / TRACK_LENGTH;
+    state.lapDistance = laps - std::floor(laps);
+  }
+  m_relativeTiming.Update(m_trackStates, m_playerIndex, m_relativeTimingData);
 }
 
 //------------------------------------------------------------------------------
@@ -127,6 +195,20 @@ void TestDataGenerator::UpdateVehicleData(float time)
   m_vehicleData.speed = 80 + (int)(20 * std::sin(time * 2.0f));
   m_vehicleData.rpm = 0.5f + 0.4f * std::sin(time * 3.0f);
   m_vehicleData.gear = std::clamp(2 + (int)(2 * (std::sin(time * 1.5f) + 1)), 1, 6);
+
+  // Lap clock, wrapping into a new lap every LAP_TIME
+  const TimeMs elapsed = INITIAL_LAP_TIME + static_cast<TimeMs>(time * 1000.0f);
+  m_vehicleData.lapTime = elapsed % LAP_TIME;
+  if (elapsed >= LAP_TIME)
+  {
+    m_vehicleData.lastLap = LAP_TIME;
+  }
+
+  // Every lap takes as long, but each gains and loses time in other places, so the delta to the best lap moves
+  constexpr float TWO_PI = 6.2831853f;
+  const float lapFraction = static_cast<float>(m_vehicleData.lapTime) / LAP_TIME;
+  const float variation = 0.01f * std::sin(static_cast<float>(elapsed / LAP_TIME) * 1.7f);
+  m_vehicleData.lapDistance = lapFraction + variation * std::sin(TWO_PI * lapFraction);
 }
 
 //------------------------------------------------------------------------------
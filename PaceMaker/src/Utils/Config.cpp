@@ -0,0 +1,99 @@
+#include <Utils/Config.h>
+
+#include <charconv>
+#include <fstream>
+
+namespace pacemaker
+{
+
+namespace
+{
+  std::string_view Trim(std::string_view text)
+  {
+    constexpr std::string_view whitespace = " \t\r\n";
+    const size_t first = text.find_first_not_of(whitespace);
+    if (first == std::string_view::npos)
+    {
+      return {};
+    }
+    return text.substr(first, text.find_last_not_of(whitespace) - first + 1);
+  }
+
+  template<typename T>
+  T Parse(const std::string* value, T fallback)
+  {
+    if (!value)
+    {
+      return fallback;
+    }
+
+    T result{};
+    const char* end = value->data() + value->size();
+    const auto [parsed, error] = std::from_chars(value->data(), end, result);
+    return error == std::errc() && parsed == end ? result : fallback;
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+bool Config::Load(const std::filesystem::path& path)
+{
+  std::ifstream file(path);
+  if (!file)
+  {
+    return false;
+  }
+
+  std::string line;
+  while (std::getline(file, line))
+  {
+    std::string_view text(line);
+    text = Trim(text.substr(0, text.find('#')));
+    const size_t separator = text.find('=');
+    if (separator == std::string_view::npos)
+    {
+      continue;
+    }
+
+    const std::string_view key = Trim(text.substr(0, separator));
+    if (!key.empty())
+    {
+      Set(key, Trim(text.substr(separator + 1)));
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void Config::Set(std::string_view key, std::string_view value)
+{
+  m_values.insert_or_assign(std::string(key), std::string(value));
+}
+
+//------------------------------------------------------------------------------
+bool Config::Contains(std::string_view key) const
+{
+  return m_values.find(key) != m_values.end();
+}
+
+//------------------------------------------------------------------------------
+std::string Config::GetString(std::string_view key, std::string_view fallback) const
+{
+  const auto it = m_values.find(key);
+  return it != m_values.end() ? it->second : std::string(fallback);
+}
+
+//------------------------------------------------------------------------------
+int Config::GetInt(std::string_view key, int fallback) const
+{
+  const auto it = m_values.find(key);
+  return Parse(it != m_values.end() ? &it->second : nullptr, fallback);
+}
+
+//------------------------------------------------------------------------------
+double Config::GetDouble(std::string_view key, double fallback) const
+{
+  const auto it = m_values.find(key);
+  return Parse(it != m_values.end() ? &it->second : nullptr, fallback);
+}
+
+} // namespace pacemaker
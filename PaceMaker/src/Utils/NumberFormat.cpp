@@ -0,0 +1,41 @@
+#include <Utils/NumberFormat.h>
+
+#include <algorithm>
+#include <charconv>
+
+namespace pacemaker
+{
+
+// Appends the suffix and the terminator after the number to_chars wrote, or empties the buffer if they do not fit
+static std::string_view Finish(std::span<char> buffer, std::to_chars_result result, std::string_view suffix)
+{
+  char* const end = buffer.data() + buffer.size();
+  if (result.ec != std::errc{} || static_cast<size_t>(end - result.ptr) < suffix.size() + 1)
+  {
+    if (!buffer.empty())
+    {
+      buffer[0] = '\0';
+    }
+    return {};
+  }
+
+  char* const last = std::copy(suffix.begin(), suffix.end(), result.ptr);
+  *last = '\0';
+  return { buffer.data(), static_cast<size_t>(last - buffer.data()) };
+}
+
+//------------------------------------------------------------------------------
+std::string_view FormatInteger(std::span<char> buffer, long long value, std::string_view suffix)
+{
+  return Finish(buffer, std::to_chars(buffer.data(), buffer.data() + buffer.size(), value), suffix);
+}
+
+//------------------------------------------------------------------------------
+std::string_view FormatFixed(std::span<char> buffer, double value, int decimals, std::string_view suffix)
+{
+  return Finish(buffer,
+    std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, std::chars_format::fixed, std::max(decimals, 0)),
+    suffix);
+}
+
+} // namespace pacemaker
@@ -0,0 +1,173 @@
+#include <Utils/TextCache.h>
+
+#include <raylib.h>
+#include <rlgl.h>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+namespace pacemaker
+{
+
+// Entries dropped when the cache grows past this, e.g. from a value that changes every frame
+static constexpr size_t MAX_ENTRIES = 4096;
+
+// Frames between sweeps for labels unused for TextCache::EVICT_AFTER_FRAMES
+static constexpr uint64_t SWEEP_INTERVAL_FRAMES = 60;
+
+// Quads submitted between checks of raylib's batch, well below its 8192 quads
+static constexpr size_t QUADS_PER_BATCH_CHECK = 1024;
+
+//------------------------------------------------------------------------------
+size_t TextCache::KeyHash::operator()(const KeyView& key) const noexcept
+{
+  // Adding 0 turns -0 into 0, which compares equal
+  size_t hash = std::hash<std::string_view>{}(key.text);
+  hash ^= std::hash<uint32_t>{}(std::bit_cast<uint32_t>(key.fontSize + 0.0f)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= std::hash<uint32_t>{}(std::bit_cast<uint32_t>(key.spacing + 0.0f)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= std::hash<unsigned int>{}(key.fontId) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+//------------------------------------------------------------------------------
+TextCache& TextCache::Instance()
+{
+  static TextCache instance;
+  return instance;
+}
+
+//------------------------------------------------------------------------------
+void TextCache::BeginFrame()
+{
+  m_lastFrame = m_frameStats;
+  m_frameStats = {};
+  ++m_frame;
+
+  if (m_entries.size() > MAX_ENTRIES)
+  {
+    // Keep what the last frame drew
+    std::erase_if(m_entries, [this](const auto& entry) { return entry.second.lastUsedFrame + 1 < m_frame; });
+  }
+  else if (m_frame % SWEEP_INTERVAL_FRAMES == 0)
+  {
+    std::erase_if(m_entries, [this](const auto& entry) { return entry.second.lastUsedFrame + EVICT_AFTER_FRAMES < m_frame; });
+  }
+}
+
+//------------------------------------------------------------------------------
+Vector2 TextCache::Measure(const Font& font, std::string_view text, float fontSize, float spacing)
+{
+  const Entry& entry = Find(font, text, fontSize, spacing);
+  return { entry.width, entry.height };
+}
+
+//------------------------------------------------------------------------------
+void TextCache::Draw(const Font& font, std::string_view text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+  const Entry& entry = Find(font, text, fontSize, spacing);
+  if (entry.textureId == 0 || entry.quads.empty())
+  {
+    return;
+  }
+
+  // Same vertices, in the same order, as DrawTexturePro() submits for each glyph
+  rlSetTexture(entry.textureId);
+  for (size_t first = 0; first < entry.quads.size(); first += QUADS_PER_BATCH_CHECK)
+  {
+    const size_t last = std::min(first + QUADS_PER_BATCH_CHECK, entry.quads.size());
+    rlCheckRenderBatchLimit(static_cast<int>(4 * (last - first)));
+
+    rlBegin(RL_QUADS);
+    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    for (size_t i = first; i < last; ++i)
+    {
+      const GlyphQuad& quad = entry.quads[i];
+      rlTexCoord2f(quad.u0, quad.v0);
+      rlVertex2f(position.x + quad.left, position.y + quad.top);
+      rlTexCoord2f(quad.u0, quad.v1);
+      rlVertex2f(position.x + quad.left, position.y + quad.bottom);
+      rlTexCoord2f(quad.u1, quad.v1);
+      rlVertex2f(position.x + quad.right, position.y + quad.bottom);
+      rlTexCoord2f(quad.u1, quad.v0);
+      rlVertex2f(position.x + quad.right, position.y + quad.top);
+    }
+    rlEnd();
+  }
+  rlSetTexture(0);
+}
+
+//------------------------------------------------------------------------------
+const TextCache::Entry& TextCache::Find(const Font& font, std::string_view text, float fontSize, float spacing)
+{
+  ++m_frameStats.lookups;
+  ++m_totalLookups;
+
+  auto it = m_entries.find(KeyView{ font.texture.id, fontSize, spacing, text });
+  if (it != m_entries.end())
+  {
+    ++m_frameStats.hits;
+    ++m_totalHits;
+  }
+  else
+  {
+    it = m_entries.try_emplace(Key{ font.texture.id, fontSize, spacing, std::string(text) }).first;
+    Layout(font, it->first.text, fontSize, spacing, it->second);
+  }
+
+  it->second.lastUsedFrame = m_frame;
+  return it->second;
+}
+
+//------------------------------------------------------------------------------
+void TextCache::Layout(const Font& font, std::string_view text, float fontSize, float spacing, Entry& entry)
+{
+  // The key's copy of the text is null-terminated
+  const Vector2 size = MeasureTextEx(font, text.data(), fontSize, spacing);
+  entry.width = size.x;
+  entry.height = size.y;
+
+  // Like DrawTextEx(), draw with the default font if the font is not loaded
+  const Font& glyphFont = font.texture.id > 0 ? font : GetFontDefault();
+  if (glyphFont.texture.id == 0 || glyphFont.baseSize <= 0 || glyphFont.texture.width <= 0 || glyphFont.texture.height <= 0)
+  {
+    return;
+  }
+  entry.textureId = glyphFont.texture.id;
+
+  const float scale = fontSize / (float)glyphFont.baseSize;
+  const float padding = (float)glyphFont.glyphPadding;
+  const float textureWidth = (float)glyphFont.texture.width;
+  const float textureHeight = (float)glyphFont.texture.height;
+
+  float offsetX = 0.0f;
+  for (size_t i = 0; i < text.size();)
+  {
+    int byteCount = 0;
+    const int codepoint = GetCodepointNext(text.data() + i, &byteCount);
+    const int index = GetGlyphIndex(glyphFont, codepoint);
+    const Rectangle& rec = glyphFont.recs[index];
+    const GlyphInfo& glyph = glyphFont.glyphs[index];
+
+    // Placed as DrawTextCodepoint() places them
+    if (codepoint != ' ' && codepoint != '\t')
+    {
+      GlyphQuad quad;
+      quad.left = offsetX + (float)glyph.offsetX * scale - padding * scale;
+      quad.top = (float)glyph.offsetY * scale - padding * scale;
+      quad.right = quad.left + (rec.width + 2.0f * padding) * scale;
+      quad.bottom = quad.top + (rec.height + 2.0f * padding) * scale;
+      quad.u0 = (rec.x - padding) / textureWidth;
+      quad.v0 = (rec.y - padding) / textureHeight;
+      quad.u1 = (rec.x - padding + rec.width + 2.0f * padding) / textureWidth;
+      quad.v1 = (rec.y - padding + rec.height + 2.0f * padding) / textureHeight;
+      entry.quads.push_back(quad);
+    }
+
+    offsetX += (glyph.advanceX == 0 ? rec.width * scale : (float)glyph.advanceX * scale) + spacing;
+    i += static_cast<size_t>(std::max(byteCount, 1));
+  }
+}
+
+} // namespace pacemaker
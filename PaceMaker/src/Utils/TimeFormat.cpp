@@ -0,0 +1,110 @@
+#include <Utils/TimeFormat.h>
+#include <Utils/NumberFormat.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <span>
+#include <string_view>
+
+namespace pacemaker
+{
+
+namespace
+{
+  /**
+   * @brief Appends text at buffer[length] and terminates it, advancing length.
+   * @return false if it does not fit; the buffer is left empty then.
+   */
+  bool Append(std::span<char> buffer, size_t& length, std::string_view text, size_t zeroPadding = 0)
+  {
+    if (length + zeroPadding + text.size() >= buffer.size())
+    {
+      if (!buffer.empty())
+      {
+        buffer[0] = '\0';
+      }
+      return false;
+    }
+
+    char* last = std::fill_n(buffer.data() + length, zeroPadding, '0');
+    last = std::copy(text.begin(), text.end(), last);
+    *last = '\0';
+    length = static_cast<size_t>(last - buffer.data());
+    return true;
+  }
+
+  /** @brief Appends a non-negative number zero-padded to width digits, e.g. "07" for the seconds of a clock. */
+  bool AppendNumber(std::span<char> buffer, size_t& length, int value, int width = 0)
+  {
+    char digits[16];
+    const std::string_view text = FormatInteger(digits, value);
+    return Append(buffer, length, text, static_cast<size_t>(std::max(width - static_cast<int>(text.size()), 0)));
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+void FormatLapTime(char* buffer, size_t size, TimeMs time)
+{
+  const std::span<char> text(buffer, size);
+  size_t length = 0;
+  if (time == NO_TIME || time < 0)
+  {
+    Append(text, length, "-");
+    return;
+  }
+
+  const int minutes = time / 60000;
+  const int seconds = (time / 1000) % 60;
+  const int millis = time % 1000;
+  AppendNumber(text, length, minutes) && Append(text, length, ":") && AppendNumber(text, length, seconds, 2)
+    && Append(text, length, ".") && AppendNumber(text, length, millis, 3);
+}
+
+//------------------------------------------------------------------------------
+void FormatGap(char* buffer, size_t size, TimeMs gap, int decimals)
+{
+  if (gap == NO_TIME)
+  {
+    if (size > 0)
+    {
+      buffer[0] = '\0';
+    }
+    return;
+  }
+
+  decimals = std::clamp(decimals, 1, 3);
+  const int unit = decimals == 1 ? 100 : decimals == 2 ? 10 : 1;
+
+  // Round to the shown precision in integers, so the sign and the zero case agree with what is displayed
+  const int magnitude = (std::abs(gap) + unit / 2) / unit;
+  const std::span<char> text(buffer, size);
+  if (magnitude == 0)
+  {
+    FormatFixed(text, 0.0, decimals);
+    return;
+  }
+
+  const int scale = 1000 / unit;
+  size_t length = 0;
+  Append(text, length, gap > 0 ? "+" : "-") && AppendNumber(text, length, magnitude / scale)
+    && Append(text, length, ".") && AppendNumber(text, length, magnitude % scale, decimals);
+}
+
+//------------------------------------------------------------------------------
+void FormatSessionTime(char* buffer, size_t size, TimeMs time)
+{
+  const std::span<char> text(buffer, size);
+  size_t length = 0;
+  if (time == NO_TIME || time < 0)
+  {
+    Append(text, length, "-");
+    return;
+  }
+
+  const int totalSeconds = time / 1000;
+  AppendNumber(text, length, totalSeconds / 3600) && Append(text, length, ":")
+    && AppendNumber(text, length, (totalSeconds / 60) % 60, 2) && Append(text, length, ":")
+    && AppendNumber(text, length, totalSeconds % 60, 2);
+}
+
+} // namespace pacemaker
@@ -0,0 +1,264 @@
+#include <Utils/TraceGraphBuffer.h>
+
+#include <raylib.h>
+#include <rlgl.h>
+#include <raymath.h>
+
+#include <algorithm>
+
+namespace pacemaker
+{
+
+// Places a segment's corners: the segment runs from the previous sample to its own, one step per sample of age,
+// and is widened across its direction like DrawLineEx(). The oldest slot's segment starts at a sample already
+// dropped from the window and is moved out of view.
+static const char* TRACE_VERTEX_SHADER = R"(#version 330
+in vec4 vertexPosition;
+uniform mat4 mvp;
+uniform vec4 graph;
+uniform vec4 traceColors[4];
+uniform vec4 traceLayouts[4];
+out vec4 fragColor;
+
+void main()
+{
+  int code = int(vertexPosition.w + 0.5);
+  int trace = code >> 2;
+  vec4 traceLayout = traceLayouts[trace];
+  float age = mod(vertexPosition.x - graph.z + graph.w, graph.w);
+
+  vec2 from = vec2(graph.x + (age - 1.0) * graph.y, traceLayout.x + vertexPosition.y * traceLayout.y);
+  vec2 to = vec2(graph.x + age * graph.y, traceLayout.x + vertexPosition.z * traceLayout.y);
+  vec2 direction = to - from;
+  float span = length(direction);
+  vec2 normal = span > 0.0 ? vec2(-direction.y, direction.x) / span : vec2(0.0, 1.0);
+  float side = (code & 2) != 0 ? 1.0 : -1.0;
+  vec2 position = ((code & 1) != 0 ? to : from) + normal * side * traceLayout.z;
+
+  fragColor = traceColors[trace];
+  gl_Position = age < 0.5 ? vec4(2.0, 2.0, 2.0, 1.0) : mvp * vec4(position, 0.0, 1.0);
+}
+)";
+
+static const char* TRACE_FRAGMENT_SHADER = R"(#version 330
+in vec4 fragColor;
+out vec4 finalColor;
+
+void main()
+{
+  finalColor = fragColor;
+}
+)";
+
+// Corners of a segment's two triangles: bit 0 selects its end, bit 1 its side. As the sides follow the segment's
+// direction, every segment winds the same way, counter-clockwise on screen like raylib's shapes.
+static constexpr int SEGMENT_CORNERS[] = { 0, 2, 3, 0, 3, 1 };
+
+//------------------------------------------------------------------------------
+TraceGraphBuffer::TraceGraphBuffer(size_t capacity, size_t traceCount)
+  : m_capacity(std::max<size_t>(capacity, 2))
+  , m_traceCount(std::clamp<size_t>(traceCount, 1, MAX_TRACES))
+  , m_lastValues(m_traceCount, 0.0f)
+  , m_vertices(m_capacity * m_traceCount * VERTICES_PER_SEGMENT)
+{
+  for (size_t slot = 0; slot < m_capacity; ++slot)
+  {
+    WriteSlot(slot, m_lastValues);
+  }
+}
+
+//------------------------------------------------------------------------------
+TraceGraphBuffer::~TraceGraphBuffer()
+{
+  Release();
+}
+
+//------------------------------------------------------------------------------
+void TraceGraphBuffer::Push(std::span<const float> values)
+{
+  const size_t count = std::min(values.size(), m_traceCount);
+  if (m_count == 0)
+  {
+    // The first sample's segment starts at itself
+    std::copy_n(values.begin(), count, m_lastValues.begin());
+  }
+
+  WriteSlot(static_cast<size_t>(m_count % m_capacity), values.first(count));
+  std::copy_n(values.begin(), count, m_lastValues.begin());
+  ++m_count;
+  m_dirtyCount = std::min(m_dirtyCount + 1, m_capacity);
+}
+
+//------------------------------------------------------------------------------
+void TraceGraphBuffer::Clear()
+{
+  m_count = 0;
+  m_dirtyCount = 0;
+}
+
+//------------------------------------------------------------------------------
+void TraceGraphBuffer::SetCapacity(size_t capacity)
+{
+  capacity = std::max<size_t>(capacity, 2);
+  if (capacity != m_capacity)
+  {
+    // The vertex buffer has the old size; the next Draw() creates one of the new
+    Release();
+    m_capacity = capacity;
+    m_vertices.assign(m_capacity * m_traceCount * VERTICES_PER_SEGMENT, Vertex{});
+    std::fill(m_lastValues.begin(), m_lastValues.end(), 0.0f);
+    for (size_t slot = 0; slot < m_capacity; ++slot)
+    {
+      WriteSlot(slot, m_lastValues);
+    }
+  }
+  Clear();
+}
+
+//------------------------------------------------------------------------------
+void TraceGraphBuffer::SetTrace(size_t trace, const Color& color, float thickness)
+{
+  if (trace >= m_traceCount)
+  {
+    return;
+  }
+
+  TraceStyle& style = m_styles[trace];
+  style.color[0] = color.r / 255.0f;
+  style.color[1] = color.g / 255.0f;
+  style.color[2] = color.b / 255.0f;
+  style.color[3] = color.a / 255.0f;
+  style.thickness = thickness;
+}
+
+//------------------------------------------------------------------------------
+void TraceGraphBuffer::WriteSlot(size_t slot, std::span<const float> values)
+{
+  Vertex* vertex = &m_vertices[slot * m_traceCount * VERTICES_PER_SEGMENT];
+  for (size_t trace = 0; trace < values.size(); ++trace)
+  {
+    for (int corner : SEGMENT_CORNERS)
+    {
+      *vertex++ = Vertex{ static_cast<float>(slot), m_lastValues[trace], values[trace],
+        static_cast<float>(corner + 4 * static_cast<int>(trace)) };
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool TraceGraphBuffer::Draw(float left, float step, std::span<const TraceLayout> layouts) const
+{
+  if (!CreateGpuObjects())
+  {
+    return false;
+  }
+  if (m_count < 2)
+  {
+    return true;
+  }
+  Upload();
+
+  // Flush what raylib batched so far, so the traces keep their place in the draw order
+  rlDrawRenderBatchActive();
+
+  const size_t oldestSlot = m_count > m_capacity ? static_cast<size_t>(m_count % m_capacity) : 0;
+  const float graph[4] = { left, step, static_cast<float>(oldestSlot), static_cast<float>(m_capacity) };
+  float colors[MAX_TRACES * 4]{};
+  float traceLayouts[MAX_TRACES * 4]{};
+  for (size_t trace = 0; trace < std::min(layouts.size(), m_traceCount); ++trace)
+  {
+    std::copy_n(m_styles[trace].color, 4, &colors[trace * 4]);
+    traceLayouts[trace * 4] = layouts[trace].baseline;
+    traceLayouts[trace * 4 + 1] = layouts[trace].scale;
+    traceLayouts[trace * 4 + 2] = m_styles[trace].thickness * 0.5f;
+  }
+
+  rlEnableShader(m_shader);
+  rlSetUniformMatrix(m_mvpLocation, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+  rlSetUniform(m_graphLocation, graph, RL_SHADER_UNIFORM_VEC4, 1);
+  rlSetUniform(m_colorsLocation, colors, RL_SHADER_UNIFORM_VEC4, MAX_TRACES);
+  rlSetUniform(m_layoutsLocation, traceLayouts, RL_SHADER_UNIFORM_VEC4, MAX_TRACES);
+
+  rlEnableVertexArray(m_vertexArray);
+  rlDrawVertexArray(0, static_cast<int>(Size() * m_traceCount * VERTICES_PER_SEGMENT));
+  rlDisableVertexArray();
+  rlDisableShader();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TraceGraphBuffer::CreateGpuObjects() const
+{
+  if (m_hasGpuObjects || m_hasGpuFailed)
+  {
+    return m_hasGpuObjects;
+  }
+
+  // rlgl hands out its default shader when ours does not compile, e.g. without GLSL 3.30
+  m_shader = rlLoadShaderCode(TRACE_VERTEX_SHADER, TRACE_FRAGMENT_SHADER);
+  const bool hasShader = m_shader != 0 && m_shader != rlGetShaderIdDefault();
+  m_vertexArray = hasShader ? rlLoadVertexArray() : 0;
+  if (m_vertexArray == 0)
+  {
+    TraceLog(LOG_WARNING, "GRAPH: No shader or vertex array support, traces are drawn line by line");
+    if (hasShader)
+    {
+      rlUnloadShaderProgram(m_shader);
+    }
+    m_shader = 0;
+    m_hasGpuFailed = true;
+    return false;
+  }
+
+  m_mvpLocation = rlGetLocationUniform(m_shader, "mvp");
+  m_graphLocation = rlGetLocationUniform(m_shader, "graph");
+  m_colorsLocation = rlGetLocationUniform(m_shader, "traceColors");
+  m_layoutsLocation = rlGetLocationUniform(m_shader, "traceLayouts");
+
+  // The whole CPU copy goes up with the buffer, nothing is left to upload
+  rlEnableVertexArray(m_vertexArray);
+  m_vertexBuffer = rlLoadVertexBuffer(m_vertices.data(), static_cast<int>(m_vertices.size() * sizeof(Vertex)), true);
+  rlSetVertexAttribute(0, 4, RL_FLOAT, false, sizeof(Vertex), 0);
+  rlEnableVertexAttribute(0);
+  rlDisableVertexArray();
+
+  m_dirtyCount = 0;
+  m_hasGpuObjects = true;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void TraceGraphBuffer::Upload() const
+{
+  // The dirty slots are the newest ones, a run that may wrap around the end of the buffer
+  size_t remaining = std::min(m_dirtyCount, Size());
+  size_t slot = static_cast<size_t>((m_count - remaining) % m_capacity);
+  const size_t slotVertices = m_traceCount * VERTICES_PER_SEGMENT;
+  const size_t slotBytes = slotVertices * sizeof(Vertex);
+  while (remaining > 0)
+  {
+    const size_t run = std::min(remaining, m_capacity - slot);
+    rlUpdateVertexBuffer(m_vertexBuffer, &m_vertices[slot * slotVertices], static_cast<int>(run * slotBytes),
+      static_cast<int>(slot * slotBytes));
+    remaining -= run;
+    slot = 0;
+  }
+  m_dirtyCount = 0;
+}
+
+//------------------------------------------------------------------------------
+void TraceGraphBuffer::Release()
+{
+  if (m_hasGpuObjects)
+  {
+    rlUnloadVertexArray(m_vertexArray);
+    rlUnloadVertexBuffer(m_vertexBuffer);
+    rlUnloadShaderProgram(m_shader);
+  }
+  m_hasGpuObjects = false;
+  m_shader = 0;
+  m_vertexArray = 0;
+  m_vertexBuffer = 0;
+}
+
+} // namespace pacemaker
@@ -1,7 +1,10 @@
 #include <Widgets/StatusIndicatorWidget.h>
+#include <Utils/TextCache.h>
 
 #include <raylib.h>
 
+#include <cstdio>
+
 namespace pacemaker
 {
 
@@ -36,6 +39,21 @@ void StatusIndicatorWidget::Render() const
 		1, 
 		YELLOW
 	);
+
+	// Text cache hit rate of the last frame; drawn uncached so it does not count itself
+	const TextCache& textCache = TextCache::Instance();
+	const TextCache::FrameStats& stats = textCache.GetLastFrameStats();
+	char statsText[96];
+	snprintf(statsText, sizeof(statsText), "Text cache: %.1f%% hits (%u of %u labels), %zu cached",
+		stats.GetHitRate() * 100.0f, stats.hits, stats.lookups, textCache.Size());
+	DrawTextEx(
+		*m_font,
+		statsText,
+		{ (float)(m_bounds.x + 15), (float)(m_bounds.y + 38) },
+		18,
+		1,
+		LIGHTGRAY
+	);
 }
 
 } // namespace pacemaker
\ No newline at end of file
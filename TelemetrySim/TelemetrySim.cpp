@@ -0,0 +1,343 @@
+#include <DataReader/SharedTelemetryWriter.h>
+#include <DataReader/UdpTelemetrySender.h>
+#include <Testing/TestDataGenerator.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+
+/**
+ * TelemetrySim stands in for a racing sim. It runs the test data generator and streams its output, either to the
+ * shared-memory region SharedTelemetryReader reads or as datagrams to a UdpTelemetryReceiver:
+ *
+ *   TelemetrySim [--shm [name] | --udp [host:port]] [--cars <n>] [--rate <hz>] [--<channel>-rate <hz>]
+ *                [--jitter <ms>] [--loss <percent>] [--burst <ms> [--burst-every <s>]] [--pause-every <s>]
+ *
+ * Each channel (input, vehicle, tire, leaderboard, relative) is written at its own rate, --rate for all of them by
+ * default, at most 10 kHz. To load-test the DataReader pipeline and the brokers without a sim:
+ * --cars         Leaderboard size, up to 200; cars beyond the first 8 are generated.
+ * --jitter       Delays every frame by a random 0..ms past its due time.
+ * --loss         Drops that percentage of frames at random.
+ * --burst        Stalls all channels for ms, every --burst-every seconds (default 5), then writes the frames due
+ *                meanwhile back to back, like a sim catching up after a hitch.
+ * --pause-every  Stops writing for as long as it wrote, over and over, like a sim that is paused and resumed.
+ */
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  constexpr double MAX_RATE_HZ = 10000.0;
+
+  std::atomic<bool> gRunning{ true };
+
+  void HandleSignal(int)
+  {
+    gRunning = false;
+  }
+
+  /**
+   * @brief Finds an option on the command line: --name [value].
+   * @param name Option name including the leading dashes.
+   * @param fallback Value used when the option is given without one.
+   * @return The option's value, fallback if it has none, or nullptr if the option was not given.
+   */
+  const char* GetOption(int argc, char* argv[], const char* name, const char* fallback)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      if (std::strcmp(argv[i], name) == 0)
+      {
+        const bool hasValue = i + 1 < argc && std::strncmp(argv[i + 1], "--", 2) != 0;
+        return hasValue ? argv[i + 1] : fallback;
+      }
+    }
+    return nullptr;
+  }
+
+  Clock::duration ToDuration(double seconds)
+  {
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+  }
+
+  /** @brief Gets a numeric option, or the fallback if it was not given. */
+  double GetNumber(int argc, char* argv[], const char* name, double fallback)
+  {
+    const char* value = GetOption(argc, argv, name, nullptr);
+    return value ? std::atof(value) : fallback;
+  }
+
+  /** @brief Where frames go: a shared-memory region or a UDP receiver. */
+  class Output
+  {
+  public:
+    bool OpenSharedMemory(const char* name)
+    {
+      return m_writer.Create(name);
+    }
+
+    bool OpenUdp(const char* host, uint16_t port)
+    {
+      return m_sender.Open(host, port);
+    }
+
+    template<typename T>
+    void Write(pacemaker::PacketType type, const T& value)
+    {
+      if (m_sender.IsOpen())
+      {
+        m_sender.Send(type, value);
+      }
+      else
+      {
+        m_writer.Write(type, value);
+      }
+    }
+
+    /** @brief Drops a frame; over UDP it uses up a sequence number, like a datagram lost on the way. */
+    void Drop(pacemaker::PacketType type)
+    {
+      if (m_sender.IsOpen())
+      {
+        m_sender.SkipPacket(type);
+      }
+    }
+
+    /** @brief Announces the strings again once a second, for a receiver started after the sim. */
+    void Tick(Clock::time_point now)
+    {
+      if (m_sender.IsOpen() && now >= m_nextResend)
+      {
+        m_sender.ResendStrings();
+        m_nextResend = now + std::chrono::seconds(1);
+      }
+    }
+
+    [[nodiscard]] uint64_t GetFailedCount() const noexcept { return m_sender.GetFailedCount(); }
+
+  private:
+    pacemaker::SharedTelemetryWriter m_writer;
+    pacemaker::UdpTelemetrySender m_sender;
+    Clock::time_point m_nextResend;
+  };
+
+  /** @brief One stream of frames with its own rate. */
+  struct Channel
+  {
+    const char* name;
+    pacemaker::PacketType type;
+    void (*write)(pacemaker::TestDataGenerator& generator, Output& output, float time);
+    double rateHz = 0.0;
+    Clock::duration period{};
+    Clock::time_point due{};     // Frame time of the next frame, advancing by period so rates do not drift
+    Clock::time_point sendAt{};  // due plus its jitter
+    uint64_t written = 0;
+    uint64_t dropped = 0;
+  };
+
+  void WriteInput(pacemaker::TestDataGenerator& generator, Output& output, float time)
+  {
+    generator.UpdateInputTelemetryData(time);
+    output.Write(pacemaker::PacketType::InputTelemetry, generator.GetInputTelemetryData());
+  }
+
+  void WriteVehicle(pacemaker::TestDataGenerator& generator, Output& output, float time)
+  {
+    generator.UpdateVehicleData(time);
+    output.Write(pacemaker::PacketType::Vehicle, generator.GetVehicleData());
+  }
+
+  void WriteTire(pacemaker::TestDataGenerator& generator, Output& output, float time)
+  {
+    generator.UpdateTireData(time);
+    output.Write(pacemaker::PacketType::TireInfo, generator.GetTireData());
+  }
+
+  void WriteLeaderboard(pacemaker::TestDataGenerator& generator, Output& output, float time)
+  {
+    generator.UpdateLeaderboardData(time);
+    output.Write(pacemaker::PacketType::Leaderboard, generator.GetLeaderboardData());
+  }
+
+  void WriteRelative(pacemaker::TestDataGenerator& generator, Output& output, float time)
+  {
+    generator.UpdateRelativeTimingData(time);
+    output.Write(pacemaker::PacketType::RelativeTiming, generator.GetRelativeTimingData());
+  }
+
+  /** @brief Settings of a run, from the command line. */
+  struct Settings
+  {
+    int cars = pacemaker::TestDataGenerator::DEFAULT_CAR_COUNT;
+    double jitterMs = 0.0;
+    double lossPercent = 0.0;
+    double burstMs = 0.0;
+    double burstEvery = 5.0;
+    double pauseEvery = 0.0;
+  };
+
+  /**
+   * @brief Writes generated telemetry until interrupted.
+   * @return Process exit code.
+   */
+  int RunEmitter(Output& output, std::span<Channel> channels, const Settings& settings)
+  {
+    using namespace pacemaker;
+
+    TestDataGenerator generator(settings.cars);
+    std::mt19937 random(std::random_device{}());
+    std::uniform_real_distribution<double> chance(0.0, 100.0);
+    std::uniform_real_distribution<double> jitter(0.0, settings.jitterMs / 1000.0);
+
+    const auto startTime = Clock::now();
+    for (Channel& channel : channels)
+    {
+      channel.period = ToDuration(1.0 / channel.rateHz);
+      channel.due = channel.sendAt = startTime;
+    }
+    const auto burstLength = ToDuration(settings.burstMs / 1000.0);
+    const auto burstPeriod = ToDuration(settings.burstEvery);
+    auto nextBurst = startTime + burstPeriod;
+
+    while (gRunning)
+    {
+      Channel& channel = *std::min_element(channels.begin(), channels.end(),
+        [](const Channel& a, const Channel& b) { return a.sendAt < b.sendAt; });
+      std::this_thread::sleep_until(channel.sendAt);
+
+      // A burst holds everything back, so the frames due meanwhile go out back to back afterwards
+      if (settings.burstMs > 0.0 && channel.sendAt >= nextBurst)
+      {
+        std::this_thread::sleep_until(nextBurst + burstLength);
+        nextBurst += burstPeriod;
+      }
+      output.Tick(Clock::now());
+
+      // Frames carry their due time, not the time they went out, like a sim stamping its physics ticks
+      const double time = std::chrono::duration<double>(channel.due - startTime).count();
+      const bool isPaused = settings.pauseEvery > 0.0 && static_cast<int64_t>(time / settings.pauseEvery) % 2 == 1;
+      if (!isPaused)
+      {
+        if (settings.lossPercent > 0.0 && chance(random) < settings.lossPercent)
+        {
+          output.Drop(channel.type);
+          ++channel.dropped;
+        }
+        else
+        {
+          channel.write(generator, output, static_cast<float>(time));
+          ++channel.written;
+        }
+      }
+
+      channel.due += channel.period;
+      channel.sendAt = channel.due;
+      if (settings.jitterMs > 0.0)
+      {
+        channel.sendAt += ToDuration(jitter(random));
+      }
+    }
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+    for (const Channel& channel : channels)
+    {
+      std::printf("%-12s %10llu frames (%.0f Hz), %llu dropped\n", channel.name,
+        static_cast<unsigned long long>(channel.written), static_cast<double>(channel.written) / seconds,
+        static_cast<unsigned long long>(channel.dropped));
+    }
+    if (const uint64_t failed = output.GetFailedCount())
+    {
+      std::printf("%llu datagrams could not be sent\n", static_cast<unsigned long long>(failed));
+    }
+    return EXIT_SUCCESS;
+  }
+} // namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  using namespace pacemaker;
+
+  std::signal(SIGINT, HandleSignal);
+  std::signal(SIGTERM, HandleSignal);
+
+  const double rateHz = GetNumber(argc, argv, "--rate", 60.0);
+  std::array<Channel, 5> channels{ {
+    { "input", PacketType::InputTelemetry, WriteInput },
+    { "vehicle", PacketType::Vehicle, WriteVehicle },
+    { "tire", PacketType::TireInfo, WriteTire },
+    { "leaderboard", PacketType::Leaderboard, WriteLeaderboard },
+    { "relative", PacketType::RelativeTiming, WriteRelative },
+  } };
+  for (Channel& channel : channels)
+  {
+    const std::string option = std::string("--") + channel.name + "-rate";
+    channel.rateHz = GetNumber(argc, argv, option.c_str(), rateHz);
+    if (channel.rateHz <= 0.0 || channel.rateHz > MAX_RATE_HZ)
+    {
+      std::fprintf(stderr, "%s rate must be above 0 and at most %.0f Hz\n", channel.name, MAX_RATE_HZ);
+      return EXIT_FAILURE;
+    }
+  }
+
+  Settings settings;
+  settings.cars = static_cast<int>(GetNumber(argc, argv, "--cars", settings.cars));
+  settings.jitterMs = GetNumber(argc, argv, "--jitter", 0.0);
+  settings.lossPercent = GetNumber(argc, argv, "--loss", 0.0);
+  settings.burstMs = GetNumber(argc, argv, "--burst", 0.0);
+  settings.burstEvery = GetNumber(argc, argv, "--burst-every", settings.burstEvery);
+  settings.pauseEvery = GetNumber(argc, argv, "--pause-every", 0.0);
+  if (settings.cars < 1 || settings.cars > TestDataGenerator::MAX_CAR_COUNT)
+  {
+    std::fprintf(stderr, "--cars must be 1 to %d\n", TestDataGenerator::MAX_CAR_COUNT);
+    return EXIT_FAILURE;
+  }
+  if (settings.jitterMs < 0.0 || settings.lossPercent < 0.0 || settings.lossPercent > 100.0 || settings.burstMs < 0.0 ||
+    settings.burstEvery <= 0.0)
+  {
+    std::fprintf(stderr, "--jitter and --burst must not be negative, --loss 0 to 100, --burst-every positive\n");
+    return EXIT_FAILURE;
+  }
+
+  Output output;
+  if (const char* endpoint = GetOption(argc, argv, "--udp", "127.0.0.1"))
+  {
+    // host[:port]
+    std::string host(endpoint);
+    uint16_t port = DEFAULT_TELEMETRY_PORT;
+    if (const size_t colon = host.rfind(':'); colon != std::string::npos)
+    {
+      port = static_cast<uint16_t>(std::atoi(host.c_str() + colon + 1));
+      host.resize(colon);
+    }
+    if (!output.OpenUdp(host.c_str(), port))
+    {
+      std::fprintf(stderr, "Could not open a UDP socket to %s:%u\n", host.c_str(), static_cast<unsigned>(port));
+      return EXIT_FAILURE;
+    }
+    std::printf("Sending telemetry to %s:%u", host.c_str(), static_cast<unsigned>(port));
+  }
+  else
+  {
+    const char* name = GetOption(argc, argv, "--shm", DEFAULT_SHARED_TELEMETRY_NAME);
+    name = name ? name : DEFAULT_SHARED_TELEMETRY_NAME;
+    if (!output.OpenSharedMemory(name))
+    {
+      std::fprintf(stderr, "Could not create shared memory region %s\n", name);
+      return EXIT_FAILURE;
+    }
+    std::printf("Writing telemetry to shared memory region %s", name);
+  }
+  std::printf(" for %d cars, Ctrl+C to stop\n", settings.cars);
+
+  return RunEmitter(output, channels, settings);
+}